@@ -29,6 +29,7 @@ public class OpenTournamentTestsRunTime : ModuleRules
 				"EnhancedInput",
 				"CQTest",
 				"CQTestEnhancedInput",
+				"Json",
 				// ... add private dependencies that you statically link with here ...
 			}
 		);
@@ -0,0 +1,343 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Utilities/OpenTournamentTestsNetworkComponent.h"
+
+#if ENABLE_OpenTournamentTests_NETWORK_TEST
+
+#include "CQTest.h"
+#include "Dom/JsonObject.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Replays/UR_DemoNetDriver.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tests/AutomationEditorCommon.h"
+
+/**
+ * Records per-frame cost of a single server world: game thread time from the start of its tick to the end of its net
+ * flush (so replication is included), and the number of allocations made in between.
+ */
+struct FBotMatchFrameSampler
+{
+	TArray<double> FrameMs;
+	TArray<int64> FrameAllocations;
+
+	int32 PeakActors = 0;
+	int32 PeakPawns = 0;
+
+	void Start(UWorld* InWorld)
+	{
+		World = InWorld;
+		TickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &FBotMatchFrameSampler::OnWorldTickStart);
+		PostTickFlushHandle = World->OnPostTickFlush().AddRaw(this, &FBotMatchFrameSampler::OnPostTickFlush);
+	}
+
+	void Stop()
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+		if (World)
+		{
+			World->OnPostTickFlush().Remove(PostTickFlushHandle);
+		}
+		World = nullptr;
+	}
+
+	int32 GetNumFrames() const
+	{
+		return FrameMs.Num();
+	}
+
+	double GetFrameMsPercentile(double Percentile) const
+	{
+		if (FrameMs.Num() == 0)
+		{
+			return 0.0;
+		}
+
+		TArray<double> Sorted = FrameMs;
+		Sorted.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Percentile / 100.0 * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+private:
+	static uint64 GetTotalAllocations()
+	{
+#if !UE_BUILD_SHIPPING
+		return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed) + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
+	}
+
+	void OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (InWorld == World)
+		{
+			TickStartCycles = FPlatformTime::Cycles64();
+			TickStartAllocations = GetTotalAllocations();
+		}
+	}
+
+	void OnPostTickFlush()
+	{
+		if (TickStartCycles == 0)
+		{
+			return;
+		}
+
+		FrameMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - TickStartCycles));
+		FrameAllocations.Add(static_cast<int64>(GetTotalAllocations() - TickStartAllocations));
+		TickStartCycles = 0;
+
+		// Once per simulated second is plenty for actor counts
+		if (FrameMs.Num() % 30 == 1)
+		{
+			int32 NumActors = 0;
+			int32 NumPawns = 0;
+			for (TActorIterator<AActor> It(World); It; ++It)
+			{
+				NumActors++;
+				NumPawns += It->IsA<APawn>() ? 1 : 0;
+			}
+			PeakActors = FMath::Max(PeakActors, NumActors);
+			PeakPawns = FMath::Max(PeakPawns, NumPawns);
+		}
+	}
+
+	UWorld* World = nullptr;
+	FDelegateHandle TickStartHandle;
+	FDelegateHandle PostTickFlushHandle;
+	uint64 TickStartCycles = 0;
+	uint64 TickStartAllocations = 0;
+};
+
+/**
+ * Server load benchmark: a dedicated server running a bot match, with one client connected.
+ *
+ * The match runs for a fixed simulated duration at a fixed 30Hz time step, so results only depend on the cost of the
+ * simulation and not on the speed of the machine. Game thread time percentiles, replicated bytes per connection,
+ * actor counts and allocations per frame are written as JSON (Saved/Benchmarks/BotMatch.json by default) to compare
+ * runs and catch regressions in weapon, movement and pickup code.
+ *
+ * Runs headless, eg. on a CPU-only Linux box:
+ *   UnrealEditor-Cmd OpenTournament.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Project.Performance.OpenTournamentTests.BotMatch;Quit"
+ *
+ * Optional command line overrides:
+ *   -OTBenchMap=/Game/Maps/...  -OTBenchExperience=...  -OTBenchBots=16  -OTBenchSeconds=120  -OTBenchOutput=<path>.json
+ *   -OTBenchSeed=1234 (bot match seed, the same seed and build replays the same bot decisions)
+ *   -OTBenchRecordReplay (the server records a replay, its recording cost per frame is added to the results)
+ */
+TEST_CLASS_WITH_FLAGS(BotMatchBenchmark, "Project.Performance.OpenTournamentTests.BotMatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+{
+	static constexpr float FixedDeltaTime = 1.f / 30.f;
+	static constexpr int32 WarmupFrames = 90;
+
+	FOpenTournamentTestsNetworkComponent<> Network{ TestRunner, TestCommandBuilder, TestRunner->bInitializing };
+	TUniquePtr<FBotMatchFrameSampler> Sampler;
+
+	FString MapName = TEXT("/OpenTournamentTests/Maps/L_ShooterTest_Basic");
+	FString Experience;
+	int32 NumBots = 8;
+	int32 NumSeconds = 60;
+	int32 Seed = 1;
+	bool bRecordReplay = false;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("BotMatch.json");
+
+	UWorld* ServerWorld = nullptr;
+	int32 WarmupFramesLeft = WarmupFrames;
+	TMap<const UNetConnection*, int64> StartOutBytes;
+	double StartRealTime = 0.0;
+
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	int32 GetNumBots() const
+	{
+		int32 Result = 0;
+		if (const AGameStateBase* GameState = ServerWorld ? ServerWorld->GetGameState() : nullptr)
+		{
+			for (const APlayerState* PlayerState : GameState->PlayerArray)
+			{
+				Result += (PlayerState && PlayerState->IsABot()) ? 1 : 0;
+			}
+		}
+		return Result;
+	}
+
+	void StartSampling()
+	{
+		for (const UNetConnection* Connection : ServerWorld->GetNetDriver()->ClientConnections)
+		{
+			StartOutBytes.Add(Connection, Connection->OutTotalBytes);
+		}
+
+		if (UUR_DemoNetDriver* DemoNetDriver = Cast<UUR_DemoNetDriver>(ServerWorld->GetDemoNetDriver()))
+		{
+			DemoNetDriver->ResetRecordStats();
+		}
+
+		StartRealTime = FPlatformTime::Seconds();
+		Sampler = MakeUnique<FBotMatchFrameSampler>();
+		Sampler->Start(ServerWorld);
+	}
+
+	void WriteResults()
+	{
+		Sampler->Stop();
+
+		const int32 NumFrames = Sampler->GetNumFrames();
+		const double SimulatedSeconds = NumFrames * FixedDeltaTime;
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("map"), MapName);
+		Json->SetStringField(TEXT("experience"), Experience);
+		Json->SetNumberField(TEXT("bots"), GetNumBots());
+		Json->SetNumberField(TEXT("seed"), Seed);
+		Json->SetNumberField(TEXT("frames"), NumFrames);
+		Json->SetNumberField(TEXT("simulated_seconds"), SimulatedSeconds);
+		Json->SetNumberField(TEXT("real_seconds"), FPlatformTime::Seconds() - StartRealTime);
+
+		TSharedRef<FJsonObject> GameThread = MakeShared<FJsonObject>();
+		double TotalMs = 0.0;
+		for (const double Ms : Sampler->FrameMs)
+		{
+			TotalMs += Ms;
+		}
+		GameThread->SetNumberField(TEXT("avg_ms"), NumFrames > 0 ? TotalMs / NumFrames : 0.0);
+		GameThread->SetNumberField(TEXT("p50_ms"), Sampler->GetFrameMsPercentile(50.0));
+		GameThread->SetNumberField(TEXT("p90_ms"), Sampler->GetFrameMsPercentile(90.0));
+		GameThread->SetNumberField(TEXT("p95_ms"), Sampler->GetFrameMsPercentile(95.0));
+		GameThread->SetNumberField(TEXT("p99_ms"), Sampler->GetFrameMsPercentile(99.0));
+		GameThread->SetNumberField(TEXT("max_ms"), Sampler->GetFrameMsPercentile(100.0));
+		Json->SetObjectField(TEXT("server_game_thread"), GameThread);
+
+		TArray<TSharedPtr<FJsonValue>> Connections;
+		for (const UNetConnection* Connection : ServerWorld->GetNetDriver()->ClientConnections)
+		{
+			const int64 OutBytes = Connection->OutTotalBytes - StartOutBytes.FindRef(Connection);
+
+			TSharedRef<FJsonObject> ConnectionJson = MakeShared<FJsonObject>();
+			ConnectionJson->SetNumberField(TEXT("out_bytes"), OutBytes);
+			ConnectionJson->SetNumberField(TEXT("out_bytes_per_second"), SimulatedSeconds > 0.0 ? OutBytes / SimulatedSeconds : 0.0);
+			Connections.Add(MakeShared<FJsonValueObject>(ConnectionJson));
+		}
+		Json->SetArrayField(TEXT("connections"), Connections);
+
+		TSharedRef<FJsonObject> Actors = MakeShared<FJsonObject>();
+		Actors->SetNumberField(TEXT("peak_actors"), Sampler->PeakActors);
+		Actors->SetNumberField(TEXT("peak_pawns"), Sampler->PeakPawns);
+		Json->SetObjectField(TEXT("server_actors"), Actors);
+
+		// Process wide, so includes the in-process client and worker threads, compare between runs rather than as absolutes
+		TSharedRef<FJsonObject> Allocations = MakeShared<FJsonObject>();
+		int64 TotalAllocations = 0;
+		int64 MaxAllocations = 0;
+		for (const int64 Count : Sampler->FrameAllocations)
+		{
+			TotalAllocations += Count;
+			MaxAllocations = FMath::Max(MaxAllocations, Count);
+		}
+		Allocations->SetNumberField(TEXT("avg_per_frame"), NumFrames > 0 ? static_cast<double>(TotalAllocations) / NumFrames : 0.0);
+		Allocations->SetNumberField(TEXT("max_per_frame"), MaxAllocations);
+		Json->SetObjectField(TEXT("allocations"), Allocations);
+
+		// Recording also shows in the server game thread times above, compare with a run without -OTBenchRecordReplay
+		if (const UUR_DemoNetDriver* DemoNetDriver = Cast<UUR_DemoNetDriver>(ServerWorld->GetDemoNetDriver()))
+		{
+			const FUR_ReplayRecordStats& RecordStats = DemoNetDriver->GetRecordStats();
+
+			TSharedRef<FJsonObject> Recording = MakeShared<FJsonObject>();
+			Recording->SetNumberField(TEXT("frames"), RecordStats.NumFrames);
+			Recording->SetNumberField(TEXT("avg_ms"), RecordStats.GetAverageMs());
+			Recording->SetNumberField(TEXT("max_ms"), RecordStats.MaxMs);
+			Recording->SetNumberField(TEXT("budget_ms"), DemoNetDriver->RecordBudgetMs);
+			Recording->SetNumberField(TEXT("frames_over_budget"), RecordStats.NumFramesOverBudget);
+			Json->SetObjectField(TEXT("replay_recording"), Recording);
+		}
+		else if (bRecordReplay)
+		{
+			TestRunner->AddWarning(TEXT("The server is not recording a replay with UR_DemoNetDriver, no recording cost reported."));
+		}
+
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(Json, Writer);
+
+		ASSERT_THAT(IsTrue(FFileHelper::SaveStringToFile(Output, *OutputPath), TEXT("Could not write the benchmark results.")));
+		TestRunner->AddInfo(FString::Printf(TEXT("Bot match benchmark results written to %s"), *OutputPath));
+	}
+
+	BEFORE_EACH()
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchMap="), MapName);
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchExperience="), Experience);
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchBots="), NumBots);
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchSeconds="), NumSeconds);
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchOutput="), OutputPath);
+		FParse::Value(FCommandLine::Get(), TEXT("OTBenchSeed="), Seed);
+		bRecordReplay = FParse::Param(FCommandLine::Get(), TEXT("OTBenchRecordReplay"));
+
+		FString ServerOptions = FString::Printf(TEXT("?NumBots=%d?BotSeed=%d"), NumBots, Seed);
+		if (!Experience.IsEmpty())
+		{
+			ServerOptions += FString::Printf(TEXT("?Experience=%s"), *Experience);
+		}
+		if (bRecordReplay)
+		{
+			ServerOptions += TEXT("?RecordReplay");
+		}
+
+		FAutomationEditorCommonUtils::LoadMap(MapName);
+
+		Network
+			.WithDedicatedServer(ServerOptions)
+			.Start()
+			.WaitForServerWorldLoaded()
+			.ThenServer(TEXT("Fetch the server world"), [this](FOpenTournamentTestsNetworkState<FOpenTournamentTestsActorTestHelper>& ServerState) {
+				ServerWorld = ServerState.World;
+				ASSERT_THAT(IsNotNull(ServerWorld));
+			});
+	}
+
+	AFTER_EACH()
+	{
+		if (Sampler)
+		{
+			Sampler->Stop();
+		}
+
+		if (PreviousFixedDeltaTime > 0.0)
+		{
+			FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+			FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+		}
+	}
+
+	TEST_METHOD(DedicatedServer_BotMatch_ReportsFrameStats)
+	{
+		const FTimespan BotSpawnTimeout = FTimespan::FromSeconds(30);
+		const FTimespan MatchTimeout = FTimespan::FromSeconds(60 + NumSeconds * 10);
+
+		TestCommandBuilder
+			.Until(TEXT("Wait for the bots"), [this]() { return GetNumBots() >= NumBots; }, BotSpawnTimeout)
+			.Then(TEXT("Switch to a fixed time step"), [this]() {
+				bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+				PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+				FApp::SetFixedDeltaTime(FixedDeltaTime);
+				FApp::SetUseFixedTimeStep(true);
+			})
+			.Until(TEXT("Warm up"), [this]() { return --WarmupFramesLeft <= 0; })
+			.Then(TEXT("Start sampling"), [this]() { StartSampling(); })
+			.Until(TEXT("Run the match"), [this]() { return Sampler->GetNumFrames() * FixedDeltaTime >= NumSeconds; }, MatchTimeout)
+			.Then(TEXT("Write the results"), [this]() { WriteResults(); });
+	}
+};
+
+#endif // ENABLE_OpenTournamentTests_NETWORK_TEST
@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Utilities/OpenTournamentTestsNetworkComponent.h"
+
+#if ENABLE_OpenTournamentTests_NETWORK_TEST
+
+#include "CQTest.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Performance/UR_MemoryBudgetSubsystem.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "UObject/UObjectGlobals.h"
+
+/**
+ * Memory soak test: a dedicated server runs a bot match with one client connected, and the physical memory the
+ * process gains over the match must stay under a threshold.
+ *
+ * Growth is measured by the server UUR_MemoryBudgetSubsystem, from a baseline taken once the match is warmed up to
+ * the end of the match, both after a full garbage collection and allocator trim so that only memory still held counts.
+ * The threshold is the MaxMatchGrowthMB of the experience memory budget, or DefaultMaxGrowthMB when it has none.
+ * The match runs at a fixed 30Hz time step, so it simulates NumSeconds whatever the speed of the machine.
+ *
+ * A stress test, kept out of the functional test runs since the match alone lasts 10 minutes by default.
+ * Runs headless, eg. on a CPU-only Linux box:
+ *   UnrealEditor-Cmd OpenTournament.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Project.Stress.OpenTournamentTests.Memory;Quit"
+ *
+ * Optional command line overrides:
+ *   -OTSoakMap=/Game/Maps/...  -OTSoakExperience=...  -OTSoakBots=8  -OTSoakSeconds=600  -OTSoakMaxGrowthMB=64
+ */
+TEST_CLASS_WITH_FLAGS(MemorySoakTest, "Project.Stress.OpenTournamentTests.Memory", EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+{
+	static constexpr float FixedDeltaTime = 1.f / 30.f;
+	static constexpr double WarmupSeconds = 10.0;
+	static constexpr float DefaultMaxGrowthMB = 64.f;
+
+	FOpenTournamentTestsNetworkComponent<> Network{ TestRunner, TestCommandBuilder, TestRunner->bInitializing };
+
+	FString MapName = TEXT("/OpenTournamentTests/Maps/L_ShooterTest_Basic");
+	FString Experience;
+	int32 NumBots = 8;
+	int32 NumSeconds = 600;
+	float MaxGrowthMB = 0.f;
+
+	UWorld* ServerWorld = nullptr;
+	double StartTime = 0.0;
+
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	UUR_MemoryBudgetSubsystem* GetServerMemoryBudget() const
+	{
+		return UWorld::GetSubsystem<UUR_MemoryBudgetSubsystem>(ServerWorld);
+	}
+
+	int32 GetNumBots() const
+	{
+		int32 Result = 0;
+		if (const AGameStateBase* GameState = ServerWorld ? ServerWorld->GetGameState() : nullptr)
+		{
+			for (const APlayerState* PlayerState : GameState->PlayerArray)
+			{
+				Result += (PlayerState && PlayerState->IsABot()) ? 1 : 0;
+			}
+		}
+		return Result;
+	}
+
+	static void ReleaseUnusedMemory()
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		GMalloc->Trim(true);
+	}
+
+	BEFORE_EACH()
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("OTSoakMap="), MapName);
+		FParse::Value(FCommandLine::Get(), TEXT("OTSoakExperience="), Experience);
+		FParse::Value(FCommandLine::Get(), TEXT("OTSoakBots="), NumBots);
+		FParse::Value(FCommandLine::Get(), TEXT("OTSoakSeconds="), NumSeconds);
+		FParse::Value(FCommandLine::Get(), TEXT("OTSoakMaxGrowthMB="), MaxGrowthMB);
+
+		FString ServerOptions = FString::Printf(TEXT("?NumBots=%d?BotSeed=1"), NumBots);
+		if (!Experience.IsEmpty())
+		{
+			ServerOptions += FString::Printf(TEXT("?Experience=%s"), *Experience);
+		}
+
+		FAutomationEditorCommonUtils::LoadMap(MapName);
+
+		Network
+			.WithDedicatedServer(ServerOptions)
+			.Start()
+			.WaitForServerWorldLoaded()
+			.ThenServer(TEXT("Fetch the server world"), [this](FOpenTournamentTestsNetworkState<FOpenTournamentTestsActorTestHelper>& ServerState) {
+				ServerWorld = ServerState.World;
+				ASSERT_THAT(IsNotNull(ServerWorld));
+			});
+	}
+
+	AFTER_EACH()
+	{
+		if (PreviousFixedDeltaTime > 0.0)
+		{
+			FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+			FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+		}
+	}
+
+	TEST_METHOD(DedicatedServer_BotMatch_MemoryGrowthUnderThreshold)
+	{
+		const FTimespan MatchTimeout = FTimespan::FromSeconds(60 + (WarmupSeconds + NumSeconds) * 10);
+
+		TestCommandBuilder
+			.Until(TEXT("Wait for the bots and the memory sampling"), [this]() {
+				const UUR_MemoryBudgetSubsystem* MemoryBudget = GetServerMemoryBudget();
+				return GetNumBots() >= NumBots && MemoryBudget && MemoryBudget->IsSampling();
+			}, FTimespan::FromSeconds(30))
+			.Then(TEXT("Switch to a fixed time step"), [this]() {
+				bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+				PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+				FApp::SetFixedDeltaTime(FixedDeltaTime);
+				FApp::SetUseFixedTimeStep(true);
+				StartTime = ServerWorld->GetTimeSeconds();
+			})
+			.Until(TEXT("Warm up"), [this]() {
+				return ServerWorld->GetTimeSeconds() - StartTime >= WarmupSeconds;
+			}, MatchTimeout)
+			.Then(TEXT("Take the baseline"), [this]() {
+				ReleaseUnusedMemory();
+				GetServerMemoryBudget()->ResetBaseline();
+				StartTime = ServerWorld->GetTimeSeconds();
+			})
+			.Until(TEXT("Run the match"), [this]() {
+				return ServerWorld->GetTimeSeconds() - StartTime >= NumSeconds;
+			}, MatchTimeout)
+			.Then(TEXT("Check the match memory growth"), [this]() {
+				ReleaseUnusedMemory();
+
+				UUR_MemoryBudgetSubsystem* MemoryBudget = GetServerMemoryBudget();
+				const FUR_MemorySample& Sample = MemoryBudget->Sample();
+				const double GrowthMB = MemoryBudget->GetMatchGrowthMB();
+
+				if (MaxGrowthMB <= 0.f)
+				{
+					MaxGrowthMB = MemoryBudget->GetBudget().MaxMatchGrowthMB > 0.f ? MemoryBudget->GetBudget().MaxMatchGrowthMB : DefaultMaxGrowthMB;
+				}
+
+				TestRunner->AddInfo(FString::Printf(TEXT("Match memory growth over %d seconds: %+.1f MB (%.1f MB used, %d UObjects, %d pooled character parts, %d budget warnings)"),
+					NumSeconds, GrowthMB, Sample.UsedPhysicalMB, Sample.NumObjects, Sample.NumPooledCharacterParts, MemoryBudget->GetNumBudgetWarnings()));
+
+				ASSERT_THAT(IsTrue(GrowthMB <= MaxGrowthMB, *FString::Printf(TEXT("Match memory grew by %.1f MB, over the %.1f MB threshold."), GrowthMB, MaxGrowthMB)));
+			});
+	}
+};
+
+#endif // ENABLE_OpenTournamentTests_NETWORK_TEST
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Character/UR_Character.h"
+#include "Character/UR_CharacterMovementComponent.h"
+#include "Components/ActorTestSpawner.h"
+#include "GameFramework/PlayerController.h"
+
+/**
+ * Client move combining against the dodge cooldown.
+ *
+ * When two saved moves are combined, the client replays them as one move from the start state of the older one, so
+ * the dodge timers must come back to that state: the combined move must count down the cooldown by the time of both
+ * moves once, like the server does when it runs them one after the other.
+ */
+TEST_CLASS_WITH_FLAGS(DodgeMoveCombiningTest, "Project.Functional Tests.OpenTournamentTests.Movement", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+	static constexpr float Cooldown = 0.5f;
+	static constexpr float MoveDeltaTime = 0.1f;
+
+	FActorTestSpawner Spawner;
+
+	AUR_Character* Character = nullptr;
+	UUR_CharacterMovementComponent* MoveComp = nullptr;
+
+	BEFORE_EACH()
+	{
+		Character = &Spawner.SpawnActor<AUR_Character>();
+		MoveComp = Cast<UUR_CharacterMovementComponent>(Character->GetCharacterMovement());
+		ASSERT_THAT(IsNotNull(MoveComp));
+	}
+
+	TEST_METHOD(CombinedMoves_InsideCooldown_CountDownOnce)
+	{
+		FNetworkPredictionData_Client_Character* ClientData = MoveComp->GetPredictionData_Client_Character();
+		ASSERT_THAT(IsNotNull(ClientData));
+
+		MoveComp->DodgeResetTime = Cooldown;
+
+		// First move, performed by the client
+		FSavedMove_URCharacter PendingMove;
+		PendingMove.SetMoveFor(Character, MoveDeltaTime, FVector::ZeroVector, *ClientData);
+		MoveComp->AdvanceMovementTimers(MoveDeltaTime);
+
+		// Second move, combined into the first one and replayed from its start
+		FSavedMove_URCharacter NewMove;
+		NewMove.SetMoveFor(Character, MoveDeltaTime, FVector::ZeroVector, *ClientData);
+		NewMove.CombineWith(&PendingMove, Character, Cast<APlayerController>(Character->GetController()), Character->GetActorLocation());
+
+		ASSERT_THAT(AreEqual(Cooldown, NewMove.StartDodgeResetTime));
+		ASSERT_THAT(AreEqual(Cooldown, MoveComp->DodgeResetTime));
+		ASSERT_THAT(IsNear(2.f * MoveDeltaTime, NewMove.DeltaTime, UE_KINDA_SMALL_NUMBER));
+
+		MoveComp->AdvanceMovementTimers(NewMove.DeltaTime);
+		const float ClientResetTime = MoveComp->DodgeResetTime;
+
+		// Server: the same two moves, one after the other
+		MoveComp->DodgeResetTime = Cooldown;
+		MoveComp->AdvanceMovementTimers(MoveDeltaTime);
+		MoveComp->AdvanceMovementTimers(MoveDeltaTime);
+
+		ASSERT_THAT(IsNear(MoveComp->DodgeResetTime, ClientResetTime, UE_KINDA_SMALL_NUMBER));
+		ASSERT_THAT(IsTrue(ClientResetTime > 0.f, TEXT("The dodge cooldown ran out in the combined move.")));
+	}
+};
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Utilities/OpenTournamentTestsNetworkComponent.h"
+
+#if ENABLE_OpenTournamentTests_NETWORK_TEST
+
+#include "CQTest.h"
+#include "Engine/DemoNetDriver.h"
+#include "Engine/GameInstance.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "Replays/UR_DemoNetDriver.h"
+#include "Replays/UR_ReplaySubsystem.h"
+#include "Tests/AutomationEditorCommon.h"
+
+/**
+ * Records a short bot match on a dedicated server, then plays the replay back on the connected client and checks that
+ * the match comes back: the game state and the bot pawns are spawned from the replay and playback time advances.
+ *
+ * Needs no rendering, eg. on a CPU-only Linux box:
+ *   UnrealEditor-Cmd OpenTournament.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Project.Functional Tests.OpenTournamentTests.Replay;Quit"
+ */
+TEST_CLASS_WITH_FLAGS(ReplayRecordingTest, "Project.Functional Tests.OpenTournamentTests.Replay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+{
+	static constexpr int32 NumBots = 4;
+	static constexpr double RecordSeconds = 10.0;
+	static constexpr double PlaybackSeconds = 3.0;
+
+	FOpenTournamentTestsNetworkComponent<> Network{ TestRunner, TestCommandBuilder, TestRunner->bInitializing };
+
+	FString MapName = TEXT("/OpenTournamentTests/Maps/L_ShooterTest_Basic");
+
+	UWorld* ServerWorld = nullptr;
+	UGameInstance* ClientGameInstance = nullptr;
+	FString ReplayName;
+	double RecordStartTime = 0.0;
+	double StopRealTime = 0.0;
+
+	UUR_ReplaySubsystem* GetServerReplaySubsystem() const
+	{
+		return UGameInstance::GetSubsystem<UUR_ReplaySubsystem>(ServerWorld ? ServerWorld->GetGameInstance() : nullptr);
+	}
+
+	UDemoNetDriver* GetPlaybackDriver() const
+	{
+		const UWorld* PlaybackWorld = ClientGameInstance ? ClientGameInstance->GetWorld() : nullptr;
+		UDemoNetDriver* DemoNetDriver = PlaybackWorld ? PlaybackWorld->GetDemoNetDriver() : nullptr;
+		return (DemoNetDriver && DemoNetDriver->IsPlaying()) ? DemoNetDriver : nullptr;
+	}
+
+	BEFORE_EACH()
+	{
+		FAutomationEditorCommonUtils::LoadMap(MapName);
+
+		Network
+			.WithDedicatedServer(FString::Printf(TEXT("?NumBots=%d?BotSeed=1?RecordReplay"), NumBots))
+			.Start()
+			.WaitForServerWorldLoaded()
+			.ThenServer(TEXT("Fetch the server world"), [this](FOpenTournamentTestsNetworkState<FOpenTournamentTestsActorTestHelper>& ServerState) {
+				ServerWorld = ServerState.World;
+				ASSERT_THAT(IsNotNull(ServerWorld));
+			})
+			.ThenClient(TEXT("Fetch the client game instance"), [this](FOpenTournamentTestsNetworkState<FOpenTournamentTestsActorTestHelper>& ClientState) {
+				ClientGameInstance = ClientState.World ? ClientState.World->GetGameInstance() : nullptr;
+				ASSERT_THAT(IsNotNull(ClientGameInstance));
+			});
+	}
+
+	TEST_METHOD(DedicatedServer_RecordedMatch_PlaysBack)
+	{
+		TestCommandBuilder
+			.Until(TEXT("Wait for the server to record"), [this]() {
+				const UUR_ReplaySubsystem* ReplaySubsystem = GetServerReplaySubsystem();
+				return ReplaySubsystem && ReplaySubsystem->IsRecording();
+			}, FTimespan::FromSeconds(30))
+			.Then(TEXT("Start the recorded match"), [this]() {
+				ReplayName = GetServerReplaySubsystem()->GetRecordingName();
+				RecordStartTime = ServerWorld->GetTimeSeconds();
+			})
+			.Until(TEXT("Record the match"), [this]() {
+				return ServerWorld->GetTimeSeconds() - RecordStartTime >= RecordSeconds;
+			}, FTimespan::FromSeconds(RecordSeconds * 10))
+			.Then(TEXT("Stop recording"), [this]() {
+				UUR_ReplaySubsystem* ReplaySubsystem = GetServerReplaySubsystem();
+				if (const UUR_DemoNetDriver* DemoNetDriver = ReplaySubsystem->GetDemoNetDriver())
+				{
+					const FUR_ReplayRecordStats& RecordStats = DemoNetDriver->GetRecordStats();
+					ASSERT_THAT(IsTrue(RecordStats.NumFrames > 0, TEXT("No frame was recorded.")));
+					TestRunner->AddInfo(FString::Printf(TEXT("Recorded %d frames, %.3f ms avg, %.3f ms max"), RecordStats.NumFrames, RecordStats.GetAverageMs(), RecordStats.MaxMs));
+				}
+
+				ReplaySubsystem->StopRecording();
+				ASSERT_THAT(IsFalse(ReplaySubsystem->IsRecording()));
+				StopRealTime = FPlatformTime::Seconds();
+			})
+			.Until(TEXT("Let the replay file be finalized"), [this]() {
+				return FPlatformTime::Seconds() - StopRealTime >= 1.0;
+			})
+			.Then(TEXT("Play the replay on the client"), [this]() {
+				UUR_ReplaySubsystem* ReplaySubsystem = UGameInstance::GetSubsystem<UUR_ReplaySubsystem>(ClientGameInstance);
+				ASSERT_THAT(IsNotNull(ReplaySubsystem));
+				ASSERT_THAT(IsTrue(ReplaySubsystem->PlayReplay(ReplayName), *FString::Printf(TEXT("Could not play replay %s."), *ReplayName)));
+			})
+			.Until(TEXT("Play back a few seconds"), [this]() {
+				const UDemoNetDriver* DemoNetDriver = GetPlaybackDriver();
+				return DemoNetDriver && DemoNetDriver->GetDemoCurrentTime() >= PlaybackSeconds;
+			}, FTimespan::FromSeconds(60))
+			.Then(TEXT("Check the played back match"), [this]() {
+				const UDemoNetDriver* DemoNetDriver = GetPlaybackDriver();
+				ASSERT_THAT(IsNotNull(DemoNetDriver));
+				ASSERT_THAT(IsTrue(DemoNetDriver->GetDemoTotalTime() > 0.f, TEXT("The replay is empty.")));
+
+				UWorld* PlaybackWorld = ClientGameInstance->GetWorld();
+				ASSERT_THAT(IsNotNull(PlaybackWorld->GetGameState(), TEXT("The game state was not played back.")));
+
+				int32 NumPawns = 0;
+				for (TActorIterator<APawn> It(PlaybackWorld); It; ++It)
+				{
+					NumPawns++;
+				}
+				ASSERT_THAT(IsTrue(NumPawns >= NumBots, *FString::Printf(TEXT("Expected at least %d pawns in the replay, found %d."), NumBots, NumPawns)));
+			});
+	}
+};
+
+#endif // ENABLE_OpenTournamentTests_NETWORK_TEST
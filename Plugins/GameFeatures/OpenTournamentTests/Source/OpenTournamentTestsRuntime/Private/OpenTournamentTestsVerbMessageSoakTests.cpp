@@ -0,0 +1,253 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Components/ActorTestSpawner.h"
+#include "Engine/NetSerialization.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Messages/GameVerbMessage.h"
+#include "Messages/GameVerbMessageReplication.h"
+#include "Serialization/BitWriter.h"
+
+/**
+ * Writes the stream entries without a net driver, which is enough to measure what a client is sent.
+ * Object references are not written, the soak messages have none.
+ */
+struct FVerbMessageSoakSerializeCB final : public INetSerializeCB
+{
+	virtual void NetSerializeStruct(FNetDeltaSerializeInfo& Params) override
+	{
+		Params.Struct->SerializeBin(*Params.Writer, Params.Data);
+	}
+
+	virtual void GatherGuidReferencesForFastArray(FFastArrayDeltaSerializeParams& Params) override {}
+	virtual bool MoveGuidToUnmappedForFastArray(FFastArrayDeltaSerializeParams& Params) override { return false; }
+	virtual void UpdateUnmappedGuidsForFastArray(FFastArrayDeltaSerializeParams& Params) override {}
+	virtual bool NetDeltaSerializeForFastArray(FFastArrayDeltaSerializeParams& Params) override { return false; }
+};
+
+/**
+ * Soak test for the verb message replication stream.
+ *
+ * Plays a simulated 60 minute match at 10 updates per second against a FGameVerbMessageReplication, with a steady
+ * message rate (kills, pickups...) and a large burst every 90 seconds (multi kills, round end).
+ * Every update goes through the stream's NetDeltaSerialize for a connected client, like the actor channel does.
+ * The stream must stay within its in-flight cap, its memory and the bits sent per update must stop growing once
+ * warmed up, and a client joining late must only be sent messages that are still alive.
+ */
+TEST_CLASS_WITH_FLAGS(VerbMessageReplicationSoakTest, "Project.Functional Tests.OpenTournamentTests.Messages", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+	static constexpr float UpdateInterval = 0.1f;
+	static constexpr int32 MatchUpdates = 60 * 60 * 10;
+	static constexpr int32 WarmupUpdates = 5 * 60 * 10;
+	static constexpr int32 BurstUpdates = 90 * 10;
+	static constexpr int32 BurstSize = 40;
+
+	FActorTestSpawner Spawner;
+
+	FGameVerbMessageReplication Stream;
+	FRandomStream Random{ 4242 };
+	FVerbMessageSoakSerializeCB SerializeCB;
+
+	UWorld* World = nullptr;
+
+	int32 MaxMessages = 0;
+	float MessageLifetime = 0.f;
+
+	// Server time each message was sent at, oldest first
+	TArray<float> SentTimes;
+
+	BEFORE_EACH()
+	{
+		const IConsoleVariable* MaxMessagesVar = IConsoleManager::Get().FindConsoleVariable(TEXT("OT.Messages.MaxVerbMessages"));
+		const IConsoleVariable* LifetimeVar = IConsoleManager::Get().FindConsoleVariable(TEXT("OT.Messages.VerbMessageLifetime"));
+		ASSERT_THAT(IsNotNull(MaxMessagesVar));
+		ASSERT_THAT(IsNotNull(LifetimeVar));
+
+		MaxMessages = MaxMessagesVar->GetInt();
+		MessageLifetime = LifetimeVar->GetFloat();
+
+		// The stream reads the server time from its owner's world
+		AActor& Owner = Spawner.SpawnActor<AActor>();
+		World = Owner.GetWorld();
+		ASSERT_THAT(IsNotNull(World));
+		Stream.SetOwner(&Owner);
+	}
+
+	void SetServerTime(float ServerTime)
+	{
+		World->TimeSeconds = ServerTime;
+	}
+
+	// Returns the number of messages sent during this update
+	int32 SimulateUpdate(int32 Update)
+	{
+		const float ServerTime = Update * UpdateInterval;
+		SetServerTime(ServerTime);
+
+		int32 NumMessages = 0;
+
+		// About two messages per second
+		if (Random.FRand() < 0.2f)
+		{
+			NumMessages++;
+		}
+
+		if (Update % BurstUpdates == 0)
+		{
+			NumMessages += BurstSize;
+		}
+
+		for (int32 i = 0; i < NumMessages; i++)
+		{
+			FGameVerbMessage Message;
+			Message.Magnitude = Random.FRand();
+			Stream.AddMessage(Message);
+			SentTimes.Add(ServerTime);
+		}
+
+		return NumMessages;
+	}
+
+	// Replicates the stream to a client holding ClientState (null for a client that has received nothing yet), returns the bits written
+	int64 ReplicateTo(TSharedPtr<INetDeltaBaseState>& ClientState)
+	{
+		FBitWriter Writer(0, true);
+		TSharedPtr<INetDeltaBaseState> NewState;
+
+		FNetDeltaSerializeInfo DeltaParms;
+		DeltaParms.Writer = &Writer;
+		DeltaParms.OldState = ClientState.Get();
+		DeltaParms.NewState = &NewState;
+		DeltaParms.NetSerializeCB = &SerializeCB;
+
+		if (!Stream.NetDeltaSerialize(DeltaParms))
+		{
+			return 0;
+		}
+
+		if (NewState.IsValid())
+		{
+			ClientState = NewState;
+		}
+		return Writer.GetNumBits();
+	}
+
+	// Bits written to a client that has received nothing, for a stream holding no message
+	int64 GetEmptyStreamBits()
+	{
+		FGameVerbMessageReplication EmptyStream;
+		FBitWriter Writer(0, true);
+		TSharedPtr<INetDeltaBaseState> NewState;
+
+		FNetDeltaSerializeInfo DeltaParms;
+		DeltaParms.Writer = &Writer;
+		DeltaParms.NewState = &NewState;
+		DeltaParms.NetSerializeCB = &SerializeCB;
+
+		EmptyStream.NetDeltaSerialize(DeltaParms);
+		return Writer.GetNumBits();
+	}
+
+	// Number of messages sent during the last message lifetime, the most a client can be sent at ServerTime
+	int32 GetNumAliveMessages(float ServerTime) const
+	{
+		int32 NumAlive = 0;
+		for (int32 i = SentTimes.Num() - 1; i >= 0 && SentTimes[i] + MessageLifetime > ServerTime; i--)
+		{
+			NumAlive++;
+		}
+		return NumAlive;
+	}
+
+	TEST_METHOD(SixtyMinuteMatch_StaysBounded)
+	{
+		static constexpr int32 CostWindowUpdates = 10 * 60 * 10;
+
+		TSharedPtr<INetDeltaBaseState> ClientState;
+
+		int32 TotalMessages = 0;
+		int32 PeakMessages = 0;
+		SIZE_T WarmedUpAllocatedSize = 0;
+		int64 FirstWindowBits = 0;
+		int64 LastWindowBits = 0;
+		int64 TotalBits = 0;
+
+		for (int32 Update = 0; Update < MatchUpdates; Update++)
+		{
+			TotalMessages += SimulateUpdate(Update);
+
+			const int64 UpdateBits = ReplicateTo(ClientState);
+			TotalBits += UpdateBits;
+
+			PeakMessages = FMath::Max(PeakMessages, Stream.GetNumMessages());
+			ASSERT_THAT(IsTrue(Stream.GetNumMessages() <= MaxMessages));
+
+			if (Update == WarmupUpdates)
+			{
+				WarmedUpAllocatedSize = Stream.GetAllocatedSize();
+			}
+			else if (WarmedUpAllocatedSize > 0)
+			{
+				// Constant memory once warmed up
+				ASSERT_THAT(AreEqual(WarmedUpAllocatedSize, Stream.GetAllocatedSize()));
+			}
+
+			// Same message rate in both windows, so the same replication cost
+			if (Update >= WarmupUpdates && Update < WarmupUpdates + CostWindowUpdates)
+			{
+				FirstWindowBits += UpdateBits;
+			}
+			else if (Update >= MatchUpdates - CostWindowUpdates)
+			{
+				LastWindowBits += UpdateBits;
+			}
+		}
+
+		TestRunner->AddInfo(FString::Printf(TEXT("Verb messages: %d sent, %.1f bytes/s replicated to one client"), TotalMessages, TotalBits / 8.0 / (MatchUpdates * UpdateInterval)));
+
+		// The match must actually have pushed the stream past its cap, or nothing was tested
+		ASSERT_THAT(IsTrue(TotalMessages > MaxMessages * 100));
+		ASSERT_THAT(AreEqual(MaxMessages, PeakMessages));
+
+		// Replication cost must not grow over the match
+		ASSERT_THAT(IsTrue(FirstWindowBits > 0));
+		ASSERT_THAT(IsTrue(LastWindowBits <= FirstWindowBits * 3 / 2, TEXT("Verb message replication cost grew over the match.")));
+	}
+
+	TEST_METHOD(LateJoiner_ReceivesNoExpiredMessages)
+	{
+		const int64 EmptyStreamBits = GetEmptyStreamBits();
+
+		// Clients joining during the match are only sent what is still alive
+		for (int32 Update = 0; Update < MatchUpdates; Update++)
+		{
+			SimulateUpdate(Update);
+
+			if (Update % BurstUpdates == BurstUpdates / 2)
+			{
+				TSharedPtr<INetDeltaBaseState> LateJoinerState;
+				const int64 JoinBits = ReplicateTo(LateJoinerState);
+
+				ASSERT_THAT(IsTrue(Stream.GetNumMessages() <= GetNumAliveMessages(Update * UpdateInterval)));
+				ASSERT_THAT(AreEqual(Stream.GetNumMessages() > 0, JoinBits > EmptyStreamBits));
+			}
+		}
+
+		// Once the last message has expired, a late joiner is sent an empty stream
+		const float AllExpiredTime = MatchUpdates * UpdateInterval + MessageLifetime;
+		SetServerTime(AllExpiredTime);
+		ASSERT_THAT(AreEqual(0, GetNumAliveMessages(AllExpiredTime)));
+
+		TSharedPtr<INetDeltaBaseState> LateJoinerState;
+		ASSERT_THAT(AreEqual(EmptyStreamBits, ReplicateTo(LateJoinerState)));
+		ASSERT_THAT(AreEqual(0, Stream.GetNumMessages()));
+	}
+};
+
+#endif // WITH_AUTOMATION_TESTS
@@ -94,6 +94,35 @@ public:
 		return *this;
 	}
 
+	/**
+	 * Run the server as a dedicated server instead of a listen server. Must be called before `Start`.
+	 *
+	 * @param InServerGameOptions - URL options passed to the server game, eg. `?Experience=B_ShooterGame_Elimination?NumBots=8`
+	 *
+	 * @return a reference to this
+	 *
+	 * @note The server state has no local player, use `WaitForServerWorldLoaded` instead of `PrepareAndWaitForServerPlayerSpawn`.
+	 */
+	FOpenTournamentTestsNetworkComponent& WithDedicatedServer(const FString& InServerGameOptions = FString())
+	{
+		checkf(!bIsRunning, TEXT("Network Component cannot be configured when already running."));
+
+		bDedicatedServer = true;
+		ServerGameOptions = InServerGameOptions;
+		return *this;
+	}
+
+	/**
+	 * Waits until the server world has loaded its experience.
+	 *
+	 * @return a reference to this
+	 */
+	FOpenTournamentTestsNetworkComponent& WaitForServerWorldLoaded()
+	{
+		CommandBuilder->StartWhen(TEXT("Check if server world is loaded"), [this]() { return HasWorldLoaded(ServerState->World); }, LoadingScreenTimeout);
+		return *this;
+	}
+
 	/**
 	 * Add a latent command to be executed on the server.
 	 *
@@ -207,10 +236,20 @@ private:
 		}
 
 		ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
-		PlaySettings->SetPlayNetMode(PIE_ListenServer);
+		if (bDedicatedServer)
+		{
+			// Clients only, the dedicated server is created alongside them
+			PlaySettings->SetPlayNetMode(PIE_Client);
+			PlaySettings->SetPlayNumberOfClients(ClientCount);
+			PlaySettings->AdditionalServerGameOptions = ServerGameOptions;
+		}
+		else
+		{
+			PlaySettings->SetPlayNetMode(PIE_ListenServer);
 
-		// The listen server counts as a client, so we need to add one more to get a real client as well
-		PlaySettings->SetPlayNumberOfClients(ClientCount + 1);
+			// The listen server counts as a client, so we need to add one more to get a real client as well
+			PlaySettings->SetPlayNumberOfClients(ClientCount + 1);
+		}
 
 		PlaySettings->bLaunchSeparateServer = false;
 		PlaySettings->GameGetsMouseControl = false;
@@ -469,6 +508,12 @@ private:
 	/** Running state of the Network Component. */
 	bool bIsRunning = false;
 
+	/** Whether the server is a dedicated server rather than a listen server. */
+	bool bDedicatedServer = false;
+
+	/** URL options passed to the dedicated server game. */
+	FString ServerGameOptions;
+
 	/**
 	* Number of clients the Network Component will initialize for.
 	*
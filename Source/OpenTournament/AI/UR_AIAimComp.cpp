@@ -10,6 +10,8 @@
 #include "Engine/World.h"
 #include "GameFramework/Controller.h"
 
+#include "UR_BotSensingSubsystem.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_AIAimComp)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,12 +45,19 @@ FVector UUR_AIAimComp::ApplyAimCorrectionForTargetActor(const AController* MyCon
 
     GoalAimPointTime -= DT;
 
+    // Line of sight from the shared bot sensing round, a hidden target keeps the last goal instead of being tracked through walls
+    bool bTargetVisible = true;
+    if (const UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+    {
+        BotSensing->GetLineOfSight(MyController->GetPawn(), TargetActor, bTargetVisible);
+    }
+
     // If our target changed, or if we reached our aim point, or if this is taking too long
-    if (TargetActor != LastAimActor || CurrentAimPoint.Equals(GoalAimPoint, GoalTolerance) || GoalAimPointTime < 0.f)
+    if (bTargetVisible && (TargetActor != LastAimActor || CurrentAimPoint.Equals(GoalAimPoint, GoalTolerance) || GoalAimPointTime < 0.f))
     {
         TrueAimTarget = CalculateAimTargetForActor(TargetActor);
         GoalAimPoint = CalculateNewGoalAimPoint(MyController, TargetActor);
-        GoalAimPointTime = FMath::FRandRange(PointDuration.X, PointDuration.Y);
+        GoalAimPointTime = RandomStream.FRandRange(PointDuration.X, PointDuration.Y);
     }
 
     LastAimActor = const_cast<AActor*>(TargetActor);
@@ -58,6 +67,11 @@ FVector UUR_AIAimComp::ApplyAimCorrectionForTargetActor(const AController* MyCon
     return CurrentAimPoint;
 }
 
+void UUR_AIAimComp::SetRandomSeed(int32 Seed)
+{
+    RandomStream.Initialize(Seed);
+}
+
 FVector UUR_AIAimComp::CalculateNewGoalAimPoint(const AController* MyController, const AActor* TargetActor)
 {
     const FVector& MyLoc = MyController->GetPawn()->GetPawnViewLocation();
@@ -80,7 +94,7 @@ FVector UUR_AIAimComp::CalculateNewGoalAimPoint(const AController* MyController,
     const float DistanceMin = FMath::Max(0, Distance - DistanceError);
     const float DistanceMax = DistanceMin + 2 * DistanceError;
 
-    FVector Result = CurrentAimPoint + FMath::FRandRange(DistanceMin, DistanceMax) * FMath::VRandCone(ConeAxis, ConeAngle);
+    FVector Result = CurrentAimPoint + RandomStream.FRandRange(DistanceMin, DistanceMax) * RandomStream.VRandCone(ConeAxis, ConeAngle);
 
     // Point shouldn't end up BEHIND me (if enemy is close and radius gets large)
     if (FVector::DotProduct(GoalAimPoint - MyLoc, TrueAimTarget - MyLoc) < 0.f)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Components/ActorComponent.h"
+#include "Math/RandomStream.h"
 
 #include "UR_AIAimComp.generated.h"
 
@@ -83,7 +84,12 @@ public:
     // This is meant to be called once per frame
     virtual FVector ApplyAimCorrectionForTargetActor(const AController* MyController, const AActor* TargetActor);
 
+    // Aim errors are drawn from this stream, seeded per bot so a match seed replays the same aim
+    void SetRandomSeed(int32 Seed);
+
 protected:
+    FRandomStream RandomStream;
+
 
     // Calculate a new GoalAimPoint by adding an error going from current rotation towards TrueAimTarget
     virtual FVector CalculateNewGoalAimPoint(const AController* MyController, const AActor* Actor);
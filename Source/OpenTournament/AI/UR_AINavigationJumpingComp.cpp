@@ -10,6 +10,10 @@
 #include <Engine/World.h>
 #include <GameFramework/Character.h>
 #include <GameFramework/CharacterMovementComponent.h>
+#include <Navigation/PathFollowingComponent.h>
+#include <NavigationData.h>
+
+#include "UR_BotSensingSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_AINavigationJumpingComp)
 
@@ -27,6 +31,9 @@ UUR_AINavigationJumpingComp::UUR_AINavigationJumpingComp()
     MaxStepupAngleDot = 0.1f;
     //TraceDistance = 400.f;
     DebugHitDuration = 2.f;
+
+    SegmentSweepDelegate.BindUObject(this, &UUR_AINavigationJumpingComp::OnSegmentSweepDone);
+    JumpSweepDelegate.BindUObject(this, &UUR_AINavigationJumpingComp::OnJumpSweepDone);
 }
 
 void UUR_AINavigationJumpingComp::OnRegister()
@@ -44,6 +51,13 @@ void UUR_AINavigationJumpingComp::SetPawn(APawn* NewPawn)
 {
     MyChar = Cast<ACharacter>(NewPawn);
     CharMoveComp = MyChar ? MyChar->GetCharacterMovement() : nullptr;
+
+    // Segment states and pending sweeps were for the previous pawn
+    PathGeneration++;
+    bJumpSweepPending = false;
+    CheckedPath.Reset();
+    SegmentStates.Reset();
+    SegmentPoints.Reset();
     if (CharMoveComp)
     {
         GetWorld()->GetTimerManager().SetTimer(CheckJumpTimerHandle, this, &UUR_AINavigationJumpingComp::CheckJump, JumpCheckInterval, true);
@@ -74,15 +88,8 @@ void UUR_AINavigationJumpingComp::TickComponent(float DeltaTime, enum ELevelTick
     }
 }
 
-void UUR_AINavigationJumpingComp::CheckJump()
+FCollisionShape UUR_AINavigationJumpingComp::GetJumpCheckCapsule(float& OutBottomOffset) const
 {
-    if (!IsActive() || !CharMoveComp || !CharMoveComp->IsWalking())
-        return;
-
-    const FVector& Dest = AIController->GetImmediateMoveDestination();
-    if (Dest.IsZero())
-        return;
-
     // We do a capsule trace forward such that :
     // - capsule bottom should be slightly offset to not immediately hit ground when going uphill
     // - capsule top should match player head or even a bit above to ensure we can jump
@@ -93,14 +100,136 @@ void UUR_AINavigationJumpingComp::CheckJump()
     // If StepHeight > CapsuleRadius, we will use CapsuleRadius anyways and offset the capsule upwards so that the flat part of the capsule begins at StepHeight
 
     const float Radius = CapsuleRadiusMult * CharMoveComp->UpdatedComponent->Bounds.BoxExtent.X;
-    const float BottomOffset = FMath::Max(MinGroundOffsetForTrace, CharMoveComp->MaxStepHeight - Radius);
-    const float Height = (2 * CharMoveComp->UpdatedComponent->Bounds.BoxExtent.Z) + AboveHeadOffset - BottomOffset;
+    OutBottomOffset = FMath::Max(MinGroundOffsetForTrace, CharMoveComp->MaxStepHeight - Radius);
+    const float Height = (2 * CharMoveComp->UpdatedComponent->Bounds.BoxExtent.Z) + AboveHeadOffset - OutBottomOffset;
+
+    return FCollisionShape::MakeCapsule(Radius, Height / 2.f);
+}
+
+void UUR_AINavigationJumpingComp::PrecomputePathSegments()
+{
+    const UPathFollowingComponent* PathFollowing = AIController->GetPathFollowingComponent();
+    const FNavPathSharedPtr Path = PathFollowing ? PathFollowing->GetPath() : nullptr;
+
+    // Bumping the generation drops our sweeps still queued, and ignores those in flight
+    PathGeneration++;
+    bJumpSweepPending = false;
+    CheckedPath = Path;
+    CheckedPathTimeStamp = Path.IsValid() ? Path->GetTimeStamp() : 0.0;
+
+    const TArray<ESegmentJumpState> PreviousStates = MoveTemp(SegmentStates);
+    const TArray<FVector> PreviousPoints = MoveTemp(SegmentPoints);
+    SegmentStates.Reset();
+    SegmentPoints.Reset();
+
+    UUR_BotSensingSubsystem* BotQueries = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld());
+    if (!Path.IsValid() || BotQueries == nullptr)
+    {
+        return;
+    }
+
+    const TArray<FNavPathPoint>& Points = Path->GetPathPoints();
+    const int32 NumSegments = FMath::Max(0, Points.Num() - 1);
+    SegmentStates.Init(ESegmentJumpState::Pending, NumSegments);
+    for (const FNavPathPoint& Point : Points)
+    {
+        SegmentPoints.Add(Point.Location);
+    }
+
+    float BottomOffset;
+    const FCollisionShape Capsule = GetJumpCheckCapsule(BottomOffset);
+    const FVector Offset(0, 0, BottomOffset + Capsule.GetCapsuleHalfHeight());
+
+    FCollisionQueryParams Params("AINavigationJumping_SegmentCheck", SCENE_QUERY_STAT_ONLY(AINavigationTraces), false, MyChar);
+    Params.bIgnoreTouches = true;
+
+    for (int32 Segment = 0; Segment < NumSegments; Segment++)
+    {
+        const FVector& From = Points[Segment].Location;
+        const FVector& To = Points[Segment + 1].Location;
+
+        // Climbing more than a step along the segment always needs a closer look
+        if (To.Z - From.Z > CharMoveComp->MaxStepHeight || Points[Segment].CustomNavLinkId != FNavLinkId::Invalid)
+        {
+            SegmentStates[Segment] = ESegmentJumpState::NeedsCheck;
+            continue;
+        }
+
+        // Path updated in place (eg. repathing from the current location): segments we already swept keep their result
+        int32 PreviousSegment = INDEX_NONE;
+        for (int32 i = 0; i < PreviousStates.Num(); i++)
+        {
+            if (PreviousStates[i] != ESegmentJumpState::Pending && PreviousPoints[i].Equals(From) && PreviousPoints[i + 1].Equals(To))
+            {
+                PreviousSegment = i;
+                break;
+            }
+        }
+        if (PreviousSegment != INDEX_NONE)
+        {
+            SegmentStates[Segment] = PreviousStates[PreviousSegment];
+            continue;
+        }
+
+        // Queue full, the remaining segments stay pending and get checked as we walk them
+        if (!BotQueries->QueueSweep(this, PathGeneration, From + Offset, To + Offset, ECollisionChannel::ECC_WorldStatic, Capsule, Params, SegmentSweepDelegate,
+            (static_cast<uint32>(PathGeneration) << 16) | static_cast<uint32>(Segment & 0xFFFF)))
+        {
+            break;
+        }
+    }
+}
+
+void UUR_AINavigationJumpingComp::OnSegmentSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    if ((TraceDatum.UserData >> 16) != PathGeneration)
+    {
+        return;
+    }
+
+    const int32 Segment = TraceDatum.UserData & 0xFFFF;
+    if (SegmentStates.IsValidIndex(Segment))
+    {
+        const bool bBlocked = TraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+        SegmentStates[Segment] = bBlocked ? ESegmentJumpState::NeedsCheck : ESegmentJumpState::Clear;
+    }
+}
+
+void UUR_AINavigationJumpingComp::CheckJump()
+{
+    if (!IsActive() || !CharMoveComp || !CharMoveComp->IsWalking())
+        return;
+
+    const FVector& Dest = AIController->GetImmediateMoveDestination();
+    if (Dest.IsZero())
+        return;
+
+    const UPathFollowingComponent* PathFollowing = AIController->GetPathFollowingComponent();
+    const FNavPathSharedPtr Path = PathFollowing ? PathFollowing->GetPath() : nullptr;
+
+    // New path, or the same one updated in place
+    if (Path != CheckedPath.Pin() || (Path.IsValid() && Path->GetTimeStamp() != CheckedPathTimeStamp))
+    {
+        PrecomputePathSegments();
+    }
+
+    // Nothing in the way on this segment, no need to look ahead until we reach the next one
+    const int32 Segment = PathFollowing ? PathFollowing->GetCurrentPathIndex() : INDEX_NONE;
+    if (SegmentStates.IsValidIndex(Segment) && SegmentStates[Segment] == ESegmentJumpState::Clear)
+        return;
+
+    // Previous check still in flight
+    UUR_BotSensingSubsystem* BotQueries = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld());
+    if (bJumpSweepPending || BotQueries == nullptr)
+        return;
+
+    float BottomOffset;
+    const FCollisionShape Capsule = GetJumpCheckCapsule(BottomOffset);
 
     // NOTE: This calculates distance to peak jump height - not sure if it's better to do it this way or configure a manual distance
     // NOTE: Adding 10% seems to give better results
     const float TraceDistance = 1.1f * FMath::Abs(CharMoveComp->MaxWalkSpeed * (CharMoveComp->JumpZVelocity / CharMoveComp->GetGravityZ()));
 
-    const FCollisionShape Capsule = FCollisionShape::MakeCapsule(Radius, Height / 2.f);
     const FVector& TraceStart = CharMoveComp->GetActorFeetLocation() + FVector(0, 0, BottomOffset + Capsule.GetCapsuleHalfHeight());
     const FVector& Direction2D = (Dest - CharMoveComp->GetActorLocation()).GetSafeNormal2D();
 
@@ -109,27 +238,53 @@ void UUR_AINavigationJumpingComp::CheckJump()
     FCollisionQueryParams Params("AINavigationJumping_TraceCheck", SCENE_QUERY_STAT_ONLY(AINavigationTraces), false, MyChar);
     Params.bIgnoreTouches = true;
 
-    FHitResult Hit;
     //NOTE: Not sure about CollisionChannel, using WorldStatic for now to ensure we can land onto the thing
-    GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, ECollisionChannel::ECC_WorldStatic, Capsule, Params);
+    bJumpSweepPending = BotQueries->QueueSweep(this, PathGeneration, TraceStart, TraceEnd, ECollisionChannel::ECC_WorldStatic, Capsule, Params, JumpSweepDelegate, PathGeneration);
+}
+
+void UUR_AINavigationJumpingComp::OnJumpSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    if (TraceDatum.UserData != PathGeneration)
+        return;
+
+    bJumpSweepPending = false;
+
+    // Result is a frame old, only act if we are still walking towards a destination
+    if (!IsActive() || !CharMoveComp || !CharMoveComp->IsWalking())
+        return;
+
+    const FVector& Dest = AIController->GetImmediateMoveDestination();
+    if (Dest.IsZero())
+        return;
+
+    const FHitResult* BlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+    const FHitResult Hit = BlockingHit ? *BlockingHit : FHitResult();
 
 #if ENABLE_DRAW_DEBUG
     if (bDebugTraces)
     {
-        DrawDebugCapsuleTraceSingle(GetWorld(), TraceStart, TraceEnd, Capsule.GetCapsuleRadius(), Capsule.GetCapsuleHalfHeight(), EDrawDebugTrace::ForDuration, Hit.bBlockingHit, Hit, FColor::Blue, FColor::Cyan, Hit.bBlockingHit ? DebugHitDuration : JumpCheckInterval);
+        const FCollisionShape& Capsule = TraceDatum.CollisionParams.CollisionShape;
+        DrawDebugCapsuleTraceSingle(GetWorld(), TraceDatum.Start, TraceDatum.End, Capsule.GetCapsuleRadius(), Capsule.GetCapsuleHalfHeight(), EDrawDebugTrace::ForDuration, Hit.bBlockingHit, Hit, FColor::Blue, FColor::Cyan, Hit.bBlockingHit ? DebugHitDuration : JumpCheckInterval);
     }
 #endif
 
     if (!Hit.bBlockingHit)
-    {
         return;
+
+    if (ShouldJumpForHit(Hit, Dest, TraceDatum.CollisionParams.CollisionShape.GetCapsuleRadius()))
+    {
+        // We need to jump!
+        MyChar->Jump();
     }
+}
 
+bool UUR_AINavigationJumpingComp::ShouldJumpForHit(const FHitResult& Hit, const FVector& Dest, float Radius) const
+{
     // If blocking hit is further away than our destination, we don't need to jump
     //TODO: Would be better to also check the direction of the *next* destination
     if (FVector::DistSquaredXY(CharMoveComp->GetActorLocation(), Hit.Location) > FVector::DistSquaredXY(CharMoveComp->GetActorLocation(), Dest) + 2 * Radius * Radius)
     {
-        return;
+        return false;
     }
 
     // Check if the hit happened below StepHeight
@@ -146,7 +301,7 @@ void UUR_AINavigationJumpingComp::CheckJump()
         {
             if (bDebugTraces)
                 DrawDebugLine(GetWorld(), CharMoveComp->GetActorFeetLocation(), Hit.ImpactPoint, FColor::Yellow, false, DebugHitDuration, SDPG_World, 3.f);
-            return;
+            return false;
         }
 
         // Check if surface is walkable (going uphill)
@@ -154,7 +309,7 @@ void UUR_AINavigationJumpingComp::CheckJump()
         {
             if (bDebugTraces)
                 DrawDebugLine(GetWorld(), Hit.ImpactPoint, Hit.ImpactPoint + 200 * Hit.ImpactNormal, FColor::Purple, false, DebugHitDuration, SDPG_World, 3.f);
-            return;
+            return false;
         }
 
         // Stepup and walking won't work
@@ -163,6 +318,5 @@ void UUR_AINavigationJumpingComp::CheckJump()
     if (bDebugTraces)
         DrawDebugLine(GetWorld(), Hit.ImpactPoint, Hit.ImpactPoint + 200 * Hit.ImpactNormal, FColor::Magenta, false, DebugHitDuration, SDPG_World, 3.f);
 
-    // We need to jump!
-    MyChar->Jump();
+    return true;
 }
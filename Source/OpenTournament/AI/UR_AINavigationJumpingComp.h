@@ -6,6 +6,8 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "AI/Navigation/NavigationTypes.h"
 #include "UR_AINavigationJumpingComp.generated.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +36,10 @@ class UCharacterMovementComponent;
  * or manual placement of NavLinks.
  *
  * For jumping over holes in the ground, we still have to rely on manual placement of custum Jump links for now.
+ *
+ * Traces are async and go through the shared bot query budget (UUR_BotSensingSubsystem), results are handled next frame.
+ * When a new path is assigned, each segment is swept once from end to end. Segments with nothing in the way and no
+ * climb above step height are marked clear, and the forward check is skipped entirely while walking them.
  */
 UCLASS(HideCategories = (Sockets, Tags, ComponentTick, ComponentReplication, Cooking, AssetUserData, Replication, Collision))
 class OPENTOURNAMENT_API UUR_AINavigationJumpingComp : public UActorComponent
@@ -95,6 +101,43 @@ public:
     virtual void CheckJump();
 
 protected:
+    enum class ESegmentJumpState : uint8
+    {
+        Pending,
+        Clear,
+        NeedsCheck,
+    };
+
+    // Capsule used for jump sweeps, and how far above the feet its bottom is
+    FCollisionShape GetJumpCheckCapsule(float& OutBottomOffset) const;
+
+    // Sweeps the segments of a newly assigned or updated path, segments already checked keep their state
+    void PrecomputePathSegments();
+
+    void OnSegmentSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+    void OnJumpSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+    // Whether the forward sweep hit is an obstacle we need to jump over to reach Dest
+    bool ShouldJumpForHit(const FHitResult& Hit, const FVector& Dest, float Radius) const;
+
+    // Path the segment states were computed for
+    FNavPathWeakPtr CheckedPath;
+    double CheckedPathTimeStamp = 0.0;
+
+    // Bumped on every new path, stale sweep results are ignored and stale queued sweeps dropped
+    uint16 PathGeneration = 0;
+
+    TArray<ESegmentJumpState> SegmentStates;
+
+    // Path point locations the segment states are for
+    TArray<FVector> SegmentPoints;
+
+    bool bJumpSweepPending = false;
+
+    FTraceDelegate SegmentSweepDelegate;
+    FTraceDelegate JumpSweepDelegate;
+
 
     //~ Begin UActorComponent Interface
     virtual void OnRegister() override;
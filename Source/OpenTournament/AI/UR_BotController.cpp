@@ -11,6 +11,8 @@
 
 #include "UR_AIAimComp.h"
 #include "UR_AINavigationJumpingComp.h"
+#include "UR_BotSensingSubsystem.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_BotController)
 
@@ -26,6 +28,17 @@ AUR_BotController::AUR_BotController()
     OnNewPawn.AddUObject(this, &AUR_BotController::OnNewPawnHandler);
 }
 
+void AUR_BotController::PostInitializeComponents()
+{
+    // Before Super, which initializes the player state and names the bot from the stream
+    if (!bRandomSeeded)
+    {
+        SetRandomSeed(FMath::Rand());
+    }
+
+    Super::PostInitializeComponents();
+}
+
 void AUR_BotController::InitPlayerState()
 {
     Super::InitPlayerState();
@@ -34,11 +47,38 @@ void AUR_BotController::InitPlayerState()
     {
         if (auto PS = GetPlayerState<APlayerState>())
         {
-            PS->SetPlayerNameInternal(FString::Printf(TEXT("OTBot-%d"), FMath::RandRange(10, 9999)));
+            PS->SetPlayerNameInternal(FString::Printf(TEXT("OTBot-%d"), RandomStream.RandRange(10, 9999)));
         }
     }
 }
 
+void AUR_BotController::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Controller);
+
+    if (HasAuthority())
+    {
+        if (UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+        {
+            BotSensing->RegisterBot(this);
+        }
+    }
+}
+
+void AUR_BotController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Controller);
+
+    if (UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+    {
+        BotSensing->UnregisterBot(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AUR_BotController::OnNewPawnHandler(APawn* P)
 {
     if (P)
@@ -48,12 +88,19 @@ void AUR_BotController::OnNewPawnHandler(APawn* P)
     else
     {
         //TODO: Obey gamemode's respawn rules
-        float Delay = FMath::RandRange(1.f, 4.f);
+        float Delay = RandomStream.FRandRange(1.f, 4.f);
         //NOTE: We use loop to attempt respawn every second in case respawn fails
         GetWorld()->GetTimerManager().SetTimer(RespawnTimerHandle, FTimerDelegate::CreateUObject(this, &AUR_BotController::Respawn), 1.f, true, Delay);
     }
 }
 
+void AUR_BotController::SetRandomSeed(int32 Seed)
+{
+    RandomStream.Initialize(Seed);
+    bRandomSeeded = true;
+    AimComponent->SetRandomSeed(HashCombine(GetTypeHash(Seed), GetTypeHash(TEXT("Aim"))));
+}
+
 void AUR_BotController::Respawn()
 {
     if (auto GM = GetWorld()->GetAuthGameMode())
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <ModularAIController.h>
+#include <Math/RandomStream.h>
 
 #include "UR_BotController.generated.h"
 
@@ -25,8 +26,14 @@ class OPENTOURNAMENT_API AUR_BotController
     AUR_BotController();
 
 protected:
+    virtual void PostInitializeComponents() override;
+
     virtual void InitPlayerState() override;
 
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     virtual void OnNewPawnHandler(APawn* P);
 
     virtual void UpdateControlRotation(float DeltaTime, bool bUpdatePawn) override;
@@ -46,4 +53,13 @@ public:
     // Just a wrapper that calls GameMode->RestartPlayer(), can be used as delegate for SetTimer
     UFUNCTION(BlueprintCallable)
     void Respawn();
+
+    // Seeds every random decision of this bot, call before FinishSpawning so the player name uses it too.
+    // Bots spawned without a seed get a random one in PostInitializeComponents.
+    void SetRandomSeed(int32 Seed);
+
+protected:
+    FRandomStream RandomStream;
+
+    bool bRandomSeeded = false;
 };
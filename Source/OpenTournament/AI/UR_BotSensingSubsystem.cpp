@@ -0,0 +1,431 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_BotSensingSubsystem.h"
+
+#include "CollisionQueryParams.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+
+#include "Teams/UR_TeamSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_BotSensingSubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static float BotSensingInterval = 0.25f;
+    static FAutoConsoleVariableRef CVarBotSensingInterval
+    (
+        TEXT("OT.AI.SensingInterval"),
+        BotSensingInterval,
+        TEXT("Minimum time in seconds between two bot line of sight rounds."),
+        ECVF_Default
+    );
+
+    static int32 BotSensingTracesPerFrame = 48;
+    static FAutoConsoleVariableRef CVarBotSensingTracesPerFrame
+    (
+        TEXT("OT.AI.SensingTracesPerFrame"),
+        BotSensingTracesPerFrame,
+        TEXT("Maximum number of bot async queries (line of sight traces, queued sweeps) issued per frame."),
+        ECVF_Default
+    );
+
+    static int32 BotSensingMinSightTraces = 16;
+    static FAutoConsoleVariableRef CVarBotSensingMinSightTraces
+    (
+        TEXT("OT.AI.SensingMinSightTraces"),
+        BotSensingMinSightTraces,
+        TEXT("Line of sight traces per frame kept for a round in progress, whatever the number of queued sweeps."),
+        ECVF_Default
+    );
+
+    static int32 MaxQueuedSweepsPerBot = 32;
+    static FAutoConsoleVariableRef CVarMaxQueuedSweepsPerBot
+    (
+        TEXT("OT.AI.MaxQueuedSweepsPerBot"),
+        MaxQueuedSweepsPerBot,
+        TEXT("Maximum number of sweeps a bot may have waiting for the query budget, further ones are refused."),
+        ECVF_Default
+    );
+
+    static float BotSightRange = 12000.f;
+    static FAutoConsoleVariableRef CVarBotSightRange
+    (
+        TEXT("OT.AI.SightRange"),
+        BotSightRange,
+        TEXT("Pawns further away than this are never checked for line of sight by bots."),
+        ECVF_Default
+    );
+}
+
+namespace URBotSensing
+{
+    // Round id in the top byte, pair index below
+    static uint32 MakeUserData(uint8 RoundId, int32 PairIndex)
+    {
+        return (static_cast<uint32>(RoundId) << 24) | (static_cast<uint32>(PairIndex) & 0x00FFFFFF);
+    }
+
+    static const TArray<FUR_BotTargetCandidate> NoCandidates;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+UUR_BotSensingSubsystem::UUR_BotSensingSubsystem()
+{
+    SightTraceDelegate.BindUObject(this, &ThisClass::OnSightTraceDone);
+}
+
+void UUR_BotSensingSubsystem::Deinitialize()
+{
+    Bots.Empty();
+    SensedPawns.Empty();
+    SensedPawnIndices.Empty();
+    Pairs.Empty();
+    LineOfSight.Empty();
+    QueuedSweeps.Empty();
+    SweepOwners.Empty();
+    bRoundActive = false;
+
+    Super::Deinitialize();
+}
+
+TStatId UUR_BotSensingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UUR_BotSensingSubsystem, STATGROUP_Tickables);
+}
+
+void UUR_BotSensingSubsystem::RegisterBot(AController* Bot)
+{
+    if (Bot == nullptr)
+    {
+        return;
+    }
+
+    for (const FSensingBot& Entry : Bots)
+    {
+        if (Entry.Controller == Bot)
+        {
+            return;
+        }
+    }
+
+    FSensingBot& Entry = Bots.AddDefaulted_GetRef();
+    Entry.Controller = Bot;
+}
+
+void UUR_BotSensingSubsystem::UnregisterBot(AController* Bot)
+{
+    // Cleared in place, indices are referenced by the current round
+    for (FSensingBot& Entry : Bots)
+    {
+        if (Entry.Controller == Bot)
+        {
+            Entry.Controller = nullptr;
+            Entry.Candidates.Reset();
+        }
+    }
+}
+
+const TArray<FUR_BotTargetCandidate>& UUR_BotSensingSubsystem::GetTargetCandidates(const AController* Bot) const
+{
+    for (const FSensingBot& Entry : Bots)
+    {
+        if (Entry.Controller == Bot)
+        {
+            return Entry.Candidates;
+        }
+    }
+
+    return URBotSensing::NoCandidates;
+}
+
+bool UUR_BotSensingSubsystem::GetLineOfSight(const AActor* Viewer, const AActor* Target, bool& bOutVisible) const
+{
+    if (const bool* bVisible = LineOfSight.Find(MakeTuple(TObjectKey<AActor>(Viewer), TObjectKey<AActor>(Target))))
+    {
+        bOutVisible = *bVisible;
+        return true;
+    }
+
+    return false;
+}
+
+bool UUR_BotSensingSubsystem::GetCachedTeamId(const APawn* Pawn, int32& OutTeamId) const
+{
+    if (const int32* Index = SensedPawnIndices.Find(Pawn))
+    {
+        OutTeamId = SensedPawns[*Index].TeamId;
+        return true;
+    }
+
+    return false;
+}
+
+bool UUR_BotSensingSubsystem::QueueSweep(const UObject* Owner, uint16 Generation, const FVector& Start, const FVector& End, ECollisionChannel Channel, const FCollisionShape& Shape,
+    const FCollisionQueryParams& Params, const FTraceDelegate& Delegate, uint32 UserData)
+{
+    const TObjectKey<UObject> OwnerKey(Owner);
+    FSweepOwner& SweepOwner = SweepOwners.FindOrAdd(OwnerKey);
+
+    // A new generation supersedes whatever the owner still has waiting
+    if (SweepOwner.Generation != Generation)
+    {
+        if (SweepOwner.NumQueued > 0)
+        {
+            QueuedSweeps.RemoveAll([OwnerKey](const FQueuedSweep& Sweep) { return Sweep.Owner == OwnerKey; }, EAllowShrinking::No);
+        }
+        SweepOwner.Generation = Generation;
+        SweepOwner.NumQueued = 0;
+    }
+
+    if (SweepOwner.NumQueued >= FMath::Max(1, OTConsoleVariables::MaxQueuedSweepsPerBot))
+    {
+        return false;
+    }
+    SweepOwner.NumQueued++;
+
+    FQueuedSweep& Sweep = QueuedSweeps.AddDefaulted_GetRef();
+    Sweep.Owner = OwnerKey;
+    Sweep.Start = Start;
+    Sweep.End = End;
+    Sweep.Channel = Channel;
+    Sweep.Shape = Shape;
+    Sweep.Params = Params;
+    Sweep.Delegate = Delegate;
+    Sweep.UserData = UserData;
+    return true;
+}
+
+ETeamAttitude::Type UUR_BotSensingSubsystem::GetAttitude(int32 TeamA, int32 TeamB)
+{
+    // Same rule as AUR_PlayerBotController::GetTeamAttitudeTowards
+    return TeamA != TeamB ? ETeamAttitude::Hostile : ETeamAttitude::Friendly;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_BotSensingSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!bRoundActive)
+    {
+        Bots.RemoveAll([](const FSensingBot& Entry) { return !Entry.Controller.IsValid(); });
+
+        for (auto It = SweepOwners.CreateIterator(); It; ++It)
+        {
+            if (It.Value().NumQueued == 0 && It.Key().ResolveObjectPtr() == nullptr)
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        if (Bots.Num() > 0 && GetWorld()->GetTimeSeconds() - RoundStartTime >= OTConsoleVariables::BotSensingInterval)
+        {
+            BeginRound();
+        }
+    }
+
+    // Sweeps go first but cannot take the whole budget while sight traces are waiting, or a backlog would stall the round
+    const int32 Budget = FMath::Max(1, OTConsoleVariables::BotSensingTracesPerFrame);
+    const int32 SightReserve = bRoundActive ? FMath::Clamp(FMath::Min(OTConsoleVariables::BotSensingMinSightTraces, Pairs.Num() - NextPair), 0, Budget) : 0;
+    const int32 SightBudget = Budget - IssueQueuedSweeps(Budget - SightReserve);
+
+    if (bRoundActive)
+    {
+        if (NextPair < Pairs.Num())
+        {
+            IssueSightTraces(SightBudget);
+        }
+        else if (PendingTraces <= 0)
+        {
+            FinishRound();
+        }
+    }
+}
+
+void UUR_BotSensingSubsystem::BeginRound()
+{
+    UWorld* World = GetWorld();
+    const UUR_TeamSubsystem* TeamSubsystem = World->GetSubsystem<UUR_TeamSubsystem>();
+
+    RoundId++;
+    RoundStartTime = World->GetTimeSeconds();
+    bRoundActive = true;
+    NextPair = 0;
+    PendingTraces = 0;
+
+    SensedPawns.Reset();
+    SensedPawnIndices.Reset();
+    Pairs.Reset();
+
+    for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+    {
+        AController* Controller = It->Get();
+        APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+        if (Pawn == nullptr || Pawn->IsPendingKillPending())
+        {
+            continue;
+        }
+
+        SensedPawnIndices.Add(Pawn, SensedPawns.Num());
+        FSensedPawn& Sensed = SensedPawns.AddDefaulted_GetRef();
+        Sensed.Pawn = Pawn;
+        Sensed.TeamId = TeamSubsystem ? TeamSubsystem->FindTeamFromObject(Controller) : INDEX_NONE;
+        Sensed.BotIndex = Bots.IndexOfByPredicate([Controller](const FSensingBot& Entry) { return Entry.Controller == Controller; });
+    }
+
+    const float SightRangeSquared = FMath::Square(OTConsoleVariables::BotSightRange);
+    for (int32 A = 0; A < SensedPawns.Num(); A++)
+    {
+        const FVector LocationA = SensedPawns[A].Pawn->GetActorLocation();
+        for (int32 B = A + 1; B < SensedPawns.Num(); B++)
+        {
+            if (SensedPawns[A].BotIndex == INDEX_NONE && SensedPawns[B].BotIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            if (GetAttitude(SensedPawns[A].TeamId, SensedPawns[B].TeamId) != ETeamAttitude::Hostile)
+            {
+                continue;
+            }
+
+            if (FVector::DistSquared(LocationA, SensedPawns[B].Pawn->GetActorLocation()) > SightRangeSquared)
+            {
+                continue;
+            }
+
+            FSightPair& Pair = Pairs.AddDefaulted_GetRef();
+            Pair.A = A;
+            Pair.B = B;
+        }
+    }
+}
+
+int32 UUR_BotSensingSubsystem::IssueQueuedSweeps(int32 Budget)
+{
+    UWorld* World = GetWorld();
+
+    // Oldest first, what is left waits for the next frame
+    int32 NumIssued = 0;
+    int32 NumConsumed = 0;
+    for (; NumConsumed < QueuedSweeps.Num() && NumIssued < Budget; NumConsumed++)
+    {
+        const FQueuedSweep& Sweep = QueuedSweeps[NumConsumed];
+        if (FSweepOwner* SweepOwner = SweepOwners.Find(Sweep.Owner))
+        {
+            SweepOwner->NumQueued--;
+        }
+
+        // Nobody left to take the result
+        if (Sweep.Owner.ResolveObjectPtr() == nullptr)
+        {
+            continue;
+        }
+
+        World->AsyncSweepByChannel(EAsyncTraceType::Single, Sweep.Start, Sweep.End, FQuat::Identity, Sweep.Channel, Sweep.Shape,
+            Sweep.Params, FCollisionResponseParams::DefaultResponseParam, &Sweep.Delegate, Sweep.UserData);
+        NumIssued++;
+    }
+
+    QueuedSweeps.RemoveAt(0, NumConsumed, EAllowShrinking::No);
+    return NumIssued;
+}
+
+void UUR_BotSensingSubsystem::IssueSightTraces(int32 Budget)
+{
+    if (Budget <= 0)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+
+    const int32 LastPair = FMath::Min(NextPair + Budget, Pairs.Num());
+
+    for (; NextPair < LastPair; NextPair++)
+    {
+        const FSightPair& Pair = Pairs[NextPair];
+        const APawn* PawnA = SensedPawns[Pair.A].Pawn.Get();
+        const APawn* PawnB = SensedPawns[Pair.B].Pawn.Get();
+        if (PawnA == nullptr || PawnB == nullptr)
+        {
+            continue;
+        }
+
+        // Eye to eye, anything blocking in between hides both ways
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(BotSensingSight), false);
+        Params.AddIgnoredActor(PawnA);
+        Params.AddIgnoredActor(PawnB);
+
+        World->AsyncLineTraceByChannel(EAsyncTraceType::Single, PawnA->GetPawnViewLocation(), PawnB->GetPawnViewLocation(), ECC_Visibility,
+            Params, FCollisionResponseParams::DefaultResponseParam, &SightTraceDelegate, URBotSensing::MakeUserData(RoundId, NextPair));
+        PendingTraces++;
+    }
+}
+
+void UUR_BotSensingSubsystem::OnSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    if ((TraceDatum.UserData >> 24) != RoundId || !bRoundActive)
+    {
+        return;
+    }
+
+    const int32 PairIndex = TraceDatum.UserData & 0x00FFFFFF;
+    if (Pairs.IsValidIndex(PairIndex))
+    {
+        Pairs[PairIndex].bVisible = !TraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+    }
+
+    PendingTraces--;
+}
+
+void UUR_BotSensingSubsystem::FinishRound()
+{
+    bRoundActive = false;
+
+    for (FSensingBot& Entry : Bots)
+    {
+        Entry.Candidates.Reset();
+    }
+    LineOfSight.Reset();
+
+    const auto AddCandidate = [this](const FSensedPawn& Viewer, const FSensedPawn& Target)
+    {
+        if (Viewer.BotIndex != INDEX_NONE && Bots[Viewer.BotIndex].Controller.IsValid() && Target.Pawn.IsValid() && Viewer.Pawn.IsValid())
+        {
+            FUR_BotTargetCandidate& Candidate = Bots[Viewer.BotIndex].Candidates.AddDefaulted_GetRef();
+            Candidate.Pawn = Target.Pawn;
+            Candidate.Distance = FVector::Dist(Viewer.Pawn->GetActorLocation(), Target.Pawn->GetActorLocation());
+        }
+    };
+
+    for (const FSightPair& Pair : Pairs)
+    {
+        const APawn* PawnA = SensedPawns[Pair.A].Pawn.Get();
+        const APawn* PawnB = SensedPawns[Pair.B].Pawn.Get();
+        if (PawnA && PawnB)
+        {
+            LineOfSight.Add(MakeTuple(TObjectKey<AActor>(PawnA), TObjectKey<AActor>(PawnB)), Pair.bVisible);
+            LineOfSight.Add(MakeTuple(TObjectKey<AActor>(PawnB), TObjectKey<AActor>(PawnA)), Pair.bVisible);
+        }
+
+        if (Pair.bVisible)
+        {
+            AddCandidate(SensedPawns[Pair.A], SensedPawns[Pair.B]);
+            AddCandidate(SensedPawns[Pair.B], SensedPawns[Pair.A]);
+        }
+    }
+
+    for (FSensingBot& Entry : Bots)
+    {
+        Entry.Candidates.Sort([](const FUR_BotTargetCandidate& A, const FUR_BotTargetCandidate& B) { return A.Distance < B.Distance; });
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "GenericTeamAgentInterface.h"
+#include "WorldCollision.h"
+
+#include "UR_BotSensingSubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AController;
+class APawn;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A pawn a bot can currently see and may want to shoot at.
+ */
+USTRUCT(BlueprintType)
+struct FUR_BotTargetCandidate
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    TWeakObjectPtr<APawn> Pawn;
+
+    UPROPERTY(BlueprintReadOnly)
+    float Distance = 0.f;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Shared line of sight checks for every bot of the world.
+ *
+ * Sensing runs in rounds. A round snapshots the pawns and their teams, then lists each pair of hostile pawns within
+ * OT.AI.SightRange where at least one side is a bot. Visibility is symmetric, so each pair is traced once, eye to eye,
+ * with async traces spread over frames (OT.AI.SensingTracesPerFrame per frame). When all traces of a round are back,
+ * every bot gets its visible targets sorted by distance, and a new round starts once OT.AI.SensingInterval has elapsed.
+ *
+ * Bots read line of sight from the last completed round rather than tracing on their own: AUR_Character answers the
+ * perception sight sense from it (IAISightTargetInterface), and UUR_AIAimComp holds its aim on hidden targets.
+ * Results are up to a round old, pairs the round did not check (friendly, out of range) are left to the caller.
+ *
+ * Other bot collision queries (eg. navigation jump checks) are queued here too and share the same per-frame budget.
+ * Queued sweeps are issued first, but leave at least OT.AI.SensingMinSightTraces to a round in progress. Each owner
+ * has at most OT.AI.MaxQueuedSweepsPerBot sweeps waiting, and queueing a new generation drops its older ones.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_BotSensingSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UUR_BotSensingSubsystem();
+
+    //~USubsystem interface
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    //~FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    //~End of FTickableGameObject interface
+
+    void RegisterBot(AController* Bot);
+
+    void UnregisterBot(AController* Bot);
+
+    // Visible hostile pawns of the last completed round, closest first
+    const TArray<FUR_BotTargetCandidate>& GetTargetCandidates(const AController* Bot) const;
+
+    // Line of sight between two pawns in the last completed round, returns false if the round did not check the pair
+    bool GetLineOfSight(const AActor* Viewer, const AActor* Target, bool& bOutVisible) const;
+
+    // Team of Pawn's controller when the current round started, returns false if the round did not see Pawn
+    bool GetCachedTeamId(const APawn* Pawn, int32& OutTeamId) const;
+
+    /**
+     * Queues an async sweep for Owner, issued within the shared query budget. Delegate receives the result the frame after it was issued.
+     * Sweeps of an older Generation still waiting are dropped, as they are once Owner is gone.
+     * Returns false, and queues nothing, if Owner already has OT.AI.MaxQueuedSweepsPerBot sweeps waiting.
+     */
+    bool QueueSweep(const UObject* Owner, uint16 Generation, const FVector& Start, const FVector& End, ECollisionChannel Channel, const FCollisionShape& Shape,
+        const FCollisionQueryParams& Params, const FTraceDelegate& Delegate, uint32 UserData);
+
+private:
+    struct FSensedPawn
+    {
+        TWeakObjectPtr<APawn> Pawn;
+        int32 TeamId = INDEX_NONE;
+        int32 BotIndex = INDEX_NONE;
+    };
+
+    struct FSightPair
+    {
+        int32 A = INDEX_NONE;
+        int32 B = INDEX_NONE;
+        bool bVisible = false;
+    };
+
+    struct FSensingBot
+    {
+        TWeakObjectPtr<AController> Controller;
+        TArray<FUR_BotTargetCandidate> Candidates;
+    };
+
+    struct FQueuedSweep
+    {
+        TObjectKey<UObject> Owner;
+        FVector Start;
+        FVector End;
+        ECollisionChannel Channel;
+        FCollisionShape Shape;
+        FCollisionQueryParams Params;
+        FTraceDelegate Delegate;
+        uint32 UserData;
+    };
+
+    struct FSweepOwner
+    {
+        uint16 Generation = 0;
+        int32 NumQueued = 0;
+    };
+
+    static ETeamAttitude::Type GetAttitude(int32 TeamA, int32 TeamB);
+
+    void BeginRound();
+
+    void FinishRound();
+
+    // Returns the number of queries issued
+    int32 IssueQueuedSweeps(int32 Budget);
+
+    void IssueSightTraces(int32 Budget);
+
+    void OnSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+    TArray<FSensingBot> Bots;
+
+    TArray<FSensedPawn> SensedPawns;
+
+    TMap<TObjectKey<APawn>, int32> SensedPawnIndices;
+
+    TArray<FSightPair> Pairs;
+
+    // Results of the last completed round, keyed by (viewer, target) pawns in both orders
+    TMap<TPair<TObjectKey<AActor>, TObjectKey<AActor>>, bool> LineOfSight;
+
+    TArray<FQueuedSweep> QueuedSweeps;
+
+    TMap<TObjectKey<UObject>, FSweepOwner> SweepOwners;
+
+    FTraceDelegate SightTraceDelegate;
+
+    uint8 RoundId = 0;
+    int32 NextPair = 0;
+    int32 PendingTraces = 0;
+    bool bRoundActive = false;
+    double RoundStartTime = 0.0;
+};
@@ -6,6 +6,10 @@
 
 #include "UObject/Object.h"
 
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
 #include "Kismet/GameplayStatics.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,15 +19,78 @@ UUR_AnnouncementSubsystem::UUR_AnnouncementSubsystem()
     , AnnouncementVoiceClass(nullptr)
     , AnnouncementVoice(nullptr)
     , AnnouncementVolume(1.f)
+    , MaxQueueLatency(2.5f)
 {
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+void UUR_AnnouncementSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Configured voice is only a soft reference, load it and its sounds ahead of the first announcement
+    if (!AnnouncementVoiceClass.IsNull())
+    {
+        VoiceLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AnnouncementVoiceClass.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &ThisClass::OnAnnouncementVoiceLoaded));
+    }
+}
+
+void UUR_AnnouncementSubsystem::Deinitialize()
+{
+    if (VoiceLoadHandle.IsValid())
+    {
+        VoiceLoadHandle->CancelHandle();
+        VoiceLoadHandle.Reset();
+    }
+
+    AnnouncementQueue.Empty();
+
+    if (AudioComponent)
+    {
+        AudioComponent->OnAudioFinished.RemoveAll(this);
+        AudioComponent->Stop();
+        AudioComponent = nullptr;
+    }
+
+    Super::Deinitialize();
+}
+
+void UUR_AnnouncementSubsystem::OnAnnouncementVoiceLoaded()
+{
+    if (AnnouncementVoice == nullptr && AnnouncementVoiceClass.Get())
+    {
+        AnnouncementVoice = AnnouncementVoiceClass.Get()->GetDefaultObject<UUR_AnnouncementVoice>();
+        PreloadAnnouncementSounds();
+    }
+}
+
 void UUR_AnnouncementSubsystem::SetAnnouncementVoice(const TSubclassOf<UUR_AnnouncementVoice> InAnnouncementVoiceClass)
 {
     AnnouncementVoiceClass = InAnnouncementVoiceClass.Get();
     AnnouncementVoice = InAnnouncementVoiceClass.GetDefaultObject();
+
+    // Announcements of the previous voice are not played anymore
+    AnnouncementQueue.Reset();
+
+    PreloadAnnouncementSounds();
+}
+
+void UUR_AnnouncementSubsystem::PreloadAnnouncementSounds() const
+{
+    if (AnnouncementVoice == nullptr)
+    {
+        return;
+    }
+
+    // Sounds are hard references of the voice, so loaded with it. Priming starts streaming in their first chunks.
+    for (const TPair<FGameplayTag, USoundBase*>& Pair : AnnouncementVoice->TagAnnouncementMap)
+    {
+        if (Pair.Value)
+        {
+            UGameplayStatics::PrimeSound(Pair.Value);
+        }
+    }
 }
 
 USoundBase* UUR_AnnouncementSubsystem::GetAnnouncementSound(const FGameplayTag& GameplayTag)
@@ -46,5 +113,96 @@ USoundBase* UUR_AnnouncementSubsystem::GetAnnouncementSound(const FGameplayTag&
 void UUR_AnnouncementSubsystem::PlayAnnouncement(const FGameplayTag& InAnnouncement)
 {
     USoundBase* AnnouncementSound = GetAnnouncementSound(InAnnouncement);
-    UGameplayStatics::PlaySound2D(this, AnnouncementSound, AnnouncementVolume);
+    if (AnnouncementSound == nullptr)
+    {
+        return;
+    }
+
+    FQueuedAnnouncement Announcement;
+    Announcement.Tag = InAnnouncement;
+    Announcement.Family = InAnnouncement.RequestDirectParent();
+    Announcement.Sound = AnnouncementSound;
+    Announcement.Priority = AnnouncementVoice->GetAnnouncementPriority(InAnnouncement);
+    Announcement.QueueTime = FPlatformTime::Seconds();
+
+    // Superseded by the newer announcement, eg. double kill by multi kill
+    if (Announcement.Family.IsValid())
+    {
+        AnnouncementQueue.RemoveAll([&Announcement](const FQueuedAnnouncement& Queued)
+        {
+            return Queued.Family == Announcement.Family;
+        });
+    }
+
+    AnnouncementQueue.Add(MoveTemp(Announcement));
+
+    if (!IsPlayingAnnouncement())
+    {
+        PlayNextAnnouncement();
+    }
+}
+
+bool UUR_AnnouncementSubsystem::IsPlayingAnnouncement() const
+{
+    return AudioComponent && AudioComponent->IsPlaying();
+}
+
+void UUR_AnnouncementSubsystem::PlayNextAnnouncement()
+{
+    const double Now = FPlatformTime::Seconds();
+
+    AnnouncementQueue.RemoveAll([this, Now](const FQueuedAnnouncement& Queued)
+    {
+        return !Queued.Sound.IsValid()
+            || (Queued.Priority != EUR_AnnouncementPriority::Critical && Now - Queued.QueueTime > MaxQueueLatency);
+    });
+
+    // Highest priority first, oldest first within a priority
+    int32 NextIndex = INDEX_NONE;
+    for (int32 i = 0; i < AnnouncementQueue.Num(); i++)
+    {
+        if (NextIndex == INDEX_NONE || AnnouncementQueue[i].Priority > AnnouncementQueue[NextIndex].Priority)
+        {
+            NextIndex = i;
+        }
+    }
+
+    if (NextIndex != INDEX_NONE)
+    {
+        USoundBase* Sound = AnnouncementQueue[NextIndex].Sound.Get();
+        AnnouncementQueue.RemoveAt(NextIndex);
+        PlayAnnouncementSound(Sound);
+    }
+}
+
+void UUR_AnnouncementSubsystem::PlayAnnouncementSound(USoundBase* Sound)
+{
+    const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+    const UWorld* World = LocalPlayer ? LocalPlayer->GetWorld() : nullptr;
+
+    // Reuse the component while we stay in the same world
+    if (AudioComponent && AudioComponent->GetWorld() == World)
+    {
+        AudioComponent->SetSound(Sound);
+        AudioComponent->SetVolumeMultiplier(AnnouncementVolume);
+        AudioComponent->Play();
+        return;
+    }
+
+    if (AudioComponent)
+    {
+        AudioComponent->OnAudioFinished.RemoveAll(this);
+    }
+
+    AudioComponent = UGameplayStatics::CreateSound2D(this, Sound, AnnouncementVolume, 1.f, 0.f, nullptr, /*bPersistAcrossLevelTransition*/ false, /*bAutoDestroy*/ false);
+    if (AudioComponent)
+    {
+        AudioComponent->OnAudioFinished.AddDynamic(this, &ThisClass::OnAnnouncementFinished);
+        AudioComponent->Play();
+    }
+}
+
+void UUR_AnnouncementSubsystem::OnAnnouncementFinished()
+{
+    PlayNextAnnouncement();
 }
@@ -14,9 +14,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward Declarations
 
+class UAudioComponent;
 class USoundBase;
 class UUR_AnnouncementVoice;
 struct FGameplayTag;
+struct FStreamableHandle;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -24,6 +26,12 @@ struct FGameplayTag;
 /**
 * AnnouncementSubsystem.
 * Handles playing Game Announcements for Local Player
+*
+* Announcements are played one at a time through a single reusable audio component.
+* While one is playing, new ones are queued and played highest priority first (see EUR_AnnouncementPriority).
+* A queued announcement is replaced by a newer one from the same family (tags with the same parent, eg. a double
+* kill by a multi kill), and dropped if it waited more than MaxQueueLatency.
+* The voice's sounds are primed as soon as the voice is set, so first plays do not hitch.
 */
 UCLASS(Config = OTUserSettings)
 class OPENTOURNAMENT_API UUR_AnnouncementSubsystem : public ULocalPlayerSubsystem
@@ -37,6 +45,9 @@ class OPENTOURNAMENT_API UUR_AnnouncementSubsystem : public ULocalPlayerSubsyste
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
 public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
     /**
     * Set the AnnouncementVoice
     */
@@ -72,4 +83,41 @@ public:
     */
     UPROPERTY(Config, BlueprintReadWrite, Category = "AnnouncementSystem")
     float AnnouncementVolume;
+
+    /**
+    * Queued announcements waiting longer than this (in seconds) are dropped, unless Critical
+    */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "AnnouncementSystem")
+    float MaxQueueLatency;
+
+private:
+    struct FQueuedAnnouncement
+    {
+        FGameplayTag Tag;
+        FGameplayTag Family;
+        TWeakObjectPtr<USoundBase> Sound;
+        EUR_AnnouncementPriority Priority = EUR_AnnouncementPriority::Normal;
+        double QueueTime = 0.0;
+    };
+
+    void OnAnnouncementVoiceLoaded();
+
+    // Prime the sounds of the current voice so they are ready to play
+    void PreloadAnnouncementSounds() const;
+
+    bool IsPlayingAnnouncement() const;
+
+    void PlayNextAnnouncement();
+
+    void PlayAnnouncementSound(USoundBase* Sound);
+
+    UFUNCTION()
+    void OnAnnouncementFinished();
+
+    TArray<FQueuedAnnouncement> AnnouncementQueue;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UAudioComponent> AudioComponent;
+
+    TSharedPtr<FStreamableHandle> VoiceLoadHandle;
 };
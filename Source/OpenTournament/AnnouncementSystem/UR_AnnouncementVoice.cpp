@@ -26,3 +26,15 @@ USoundBase* UUR_AnnouncementVoice::GetAnnouncementSound(const FGameplayTag& Game
     }
     return nullptr;
 }
+
+EUR_AnnouncementPriority UUR_AnnouncementVoice::GetAnnouncementPriority(const FGameplayTag& GameplayTag) const
+{
+    for (FGameplayTag Tag = GameplayTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+    {
+        if (const EUR_AnnouncementPriority* Priority = AnnouncementPriorities.Find(Tag))
+        {
+            return *Priority;
+        }
+    }
+    return EUR_AnnouncementPriority::Normal;
+}
@@ -16,6 +16,21 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+* Announcements are queued and played one at a time, highest priority first.
+*/
+UENUM(BlueprintType)
+enum class EUR_AnnouncementPriority : uint8
+{
+	Low,
+	Normal,
+	High,
+	// Never dropped for being queued too long
+	Critical,
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 
 /**
 * AnnouncementVoice.
@@ -51,9 +66,22 @@ class OPENTOURNAMENT_API UUR_AnnouncementVoice
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "AnnouncementSystem")
 	USoundBase* GetAnnouncementSound(const FGameplayTag& GameplayTag);
 
+	/**
+	* Get the Priority of the announcement for this GameplayTag.
+	* The most specific entry of AnnouncementPriorities wins, Normal if none matches.
+	*/
+	UFUNCTION(BlueprintPure, BlueprintCallable, Category = "AnnouncementSystem")
+	EUR_AnnouncementPriority GetAnnouncementPriority(const FGameplayTag& GameplayTag) const;
+
 	/**
 	* Map of Tags to Audio
 	*/
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayTags")
 	TMap<FGameplayTag, USoundBase*> TagAnnouncementMap;
+
+	/**
+	* Priority of announcements, applies to the tag and its children.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayTags")
+	TMap<FGameplayTag, EUR_AnnouncementPriority> AnnouncementPriorities;
 };
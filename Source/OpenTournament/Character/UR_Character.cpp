@@ -43,11 +43,14 @@
 #include "UR_Weapon.h"
 #include "AbilitySystem/Attributes/UR_HealthSet.h"
 #include "AI/AIPerceptionSourceNativeComp.h"
+#include "AI/UR_BotSensingSubsystem.h"
 #include "Attributes/UR_CombatSet.h"
 #include "Character/UR_CharacterCustomization.h"
 #include "Character/UR_CharacterMovementComponent.h"
 #include "Character/UR_HealthComponent.h"
 #include "Interfaces/UR_ActivatableInterface.h"
+#include "System/UR_ActorRegistrySubsystem.h"
+#include "Weapons/UR_SplashDamage.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_Character)
 
@@ -196,7 +199,8 @@ void AUR_Character::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(ThisClass, DodgeDirection);
+    // The owner sends its dodges through the move flags
+    DOREPLIFETIME_CONDITION(ThisClass, DodgeDirection, COND_SkipOwner);
     DOREPLIFETIME(ThisClass, InventoryComponent);
     DOREPLIFETIME(ThisClass, AbilitySystemComponent);
     DOREPLIFETIME(ThisClass, AbilitySystemComponent);
@@ -211,6 +215,8 @@ void AUR_Character::BeginPlay()
 
     Super::BeginPlay();
 
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Pawn);
+
     UUR_PaniniUtils::TogglePaniniProjection(GetMesh1P(), true, true);
 
     if (GetNetMode() == NM_DedicatedServer)
@@ -231,6 +237,13 @@ void AUR_Character::BeginPlay()
     }
 }
 
+void AUR_Character::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Pawn);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AUR_Character::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -838,7 +851,7 @@ bool AUR_Character::IsDodgePermitted_Implementation() const
     {
         IsPermitted = !URMovementComponent->IsFlying();
         IsPermitted = IsPermitted && !URMovementComponent->bIsDodging;
-        IsPermitted = IsPermitted && GetWorld()->TimeSeconds > URMovementComponent->DodgeResetTime;
+        IsPermitted = IsPermitted && URMovementComponent->DodgeResetTime <= 0.f;
     }
 
     return IsPermitted;
@@ -931,7 +944,8 @@ float AUR_Character::TakeDamage(float Damage, FDamageEvent const& DamageEvent, A
 
     GAME_LOG(LogGame, Log, "Damage pre-hook = %f", Damage);
 
-    const float Falloff = Damage / OriginalDamage;
+    // Splash damage comes with its knockback scale already resolved
+    const float Falloff = DamageEvent.IsOfType(FUR_SplashDamageEvent::ClassID) ? static_cast<const FUR_SplashDamageEvent&>(DamageEvent).KnockbackScale : Damage / OriginalDamage;
 
     // Calculate knockback power
     float KnockbackPower = 1500.f * OriginalDamage; //TODO: this is where we should fetch projectile/weapon's knockback value
@@ -1068,7 +1082,7 @@ float AUR_Character::TakeDamage(float Damage, FDamageEvent const& DamageEvent, A
     }
     */
 
-    MulticastDamageEvent(RepDamageEvent);
+    QueueDamageEvent(RepDamageEvent);
 
     ////////////////////////////////////////////////////////////
     // Death
@@ -1082,6 +1096,16 @@ float AUR_Character::TakeDamage(float Damage, FDamageEvent const& DamageEvent, A
     return Damage;
 }
 
+float AUR_Character::InternalTakeRadialDamage(float Damage, FRadialDamageEvent const& RadialDamageEvent, AController* EventInstigator, AActor* DamageCauser)
+{
+    if (RadialDamageEvent.IsOfType(FUR_SplashDamageEvent::ClassID))
+    {
+        return static_cast<const FUR_SplashDamageEvent&>(RadialDamageEvent).Damage;
+    }
+
+    return Super::InternalTakeRadialDamage(Damage, RadialDamageEvent, EventInstigator, DamageCauser);
+}
+
 void AUR_Character::FellOutOfWorld(const UDamageType& DamageType)
 {
     if (HealthComponent)
@@ -1094,7 +1118,73 @@ void AUR_Character::FellOutOfWorld(const UDamageType& DamageType)
     }
 }
 
-void AUR_Character::MulticastDamageEvent_Implementation(const FReplicatedDamageEvent RepDamageEvent)
+void AUR_Character::QueueDamageEvent(const FReplicatedDamageEvent& RepDamageEvent)
+{
+    const FUR_CompactDamageEvent CompactEvent = FUR_CompactDamageEvent::Make(this, RepDamageEvent);
+
+    for (FUR_CompactDamageEvent& PendingEvent : PendingDamageEvents)
+    {
+        if (PendingEvent.TryMerge(CompactEvent))
+        {
+            return;
+        }
+    }
+
+    if (PendingDamageEvents.IsEmpty())
+    {
+        GetWorldTimerManager().SetTimerForNextTick(this, &ThisClass::FlushDamageEvents);
+    }
+
+    PendingDamageEvents.Add(CompactEvent);
+}
+
+void AUR_Character::FlushDamageEvents()
+{
+    if (PendingDamageEvents.IsEmpty())
+    {
+        return;
+    }
+
+    // Server-side listeners get the grouped events, same as every client used to get each hit
+    for (const FUR_CompactDamageEvent& PendingEvent : PendingDamageEvents)
+    {
+        BroadcastDamageEvent(PendingEvent.ToReplicatedDamageEvent());
+    }
+
+    // Only the victim, the instigators and whoever is spectating them need the notification
+    TArray<FUR_CompactDamageEvent> EventsForController;
+    for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+    {
+        AUR_PlayerController* PC = Cast<AUR_PlayerController>(Iterator->Get());
+        if (PC == nullptr || PC->IsLocalController())
+        {
+            continue;
+        }
+
+        const AActor* ViewTarget = PC->GetViewTarget();
+        const APawn* ControlledPawn = PC->GetPawn();
+        const bool bWatchesVictim = (ViewTarget == this || ControlledPawn == this);
+
+        EventsForController.Reset();
+        for (const FUR_CompactDamageEvent& PendingEvent : PendingDamageEvents)
+        {
+            const APawn* EventInstigator = PendingEvent.DamageInstigator;
+            if (bWatchesVictim || (EventInstigator && (ViewTarget == EventInstigator || ControlledPawn == EventInstigator)))
+            {
+                EventsForController.Add(PendingEvent);
+            }
+        }
+
+        if (EventsForController.Num() > 0)
+        {
+            PC->ClientReceiveDamageEvents(EventsForController);
+        }
+    }
+
+    PendingDamageEvents.Reset();
+}
+
+void AUR_Character::BroadcastDamageEvent(const FReplicatedDamageEvent& RepDamageEvent)
 {
     OnDamageReceived.Broadcast(this, RepDamageEvent);
 
@@ -1562,6 +1652,31 @@ FGameplayTag AUR_Character::GetMovementModeGameplayTag(const EMovementMode InMov
     return FGameplayTag{ };
 }
 
+UAISense_Sight::EVisibilityResult AUR_Character::CanBeSeenFrom(const FCanBeSeenFromContext& Context, FVector& OutSeenLocation, int32& OutNumberOfLoSChecksPerformed,
+    int32& OutNumberOfAsyncLosCheckRequested, float& OutSightStrength, int32* UserData, const FOnPendingVisibilityQueryProcessedDelegate* Delegate)
+{
+    OutSeenLocation = GetActorLocation();
+    OutSightStrength = 1.f;
+    OutNumberOfAsyncLosCheckRequested = 0;
+
+    // The observer is the bot's pawn, the round already traced it against us
+    bool bVisible = false;
+    const UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld());
+    if (BotSensing && BotSensing->GetLineOfSight(Context.IgnoreActor, this, bVisible))
+    {
+        OutNumberOfLoSChecksPerformed = 0;
+    }
+    else
+    {
+        FHitResult Hit;
+        const FCollisionQueryParams Params(SCENE_QUERY_STAT(AUR_Character_CanBeSeenFrom), true, Context.IgnoreActor);
+        bVisible = !GetWorld()->LineTraceSingleByChannel(Hit, Context.ObserverLocation, OutSeenLocation, ECC_Visibility, Params) || (Hit.GetActor() && Hit.GetActor()->IsOwnedBy(this));
+        OutNumberOfLoSChecksPerformed = 1;
+    }
+
+    return bVisible ? UAISense_Sight::EVisibilityResult::Visible : UAISense_Sight::EVisibilityResult::NotVisible;
+}
+
 void AUR_Character::GetOwnedGameplayTags(FGameplayTagContainer& TagContainer) const
 {
     if (const UUR_AbilitySystemComponent* ASC = GetGameAbilitySystemComponent())
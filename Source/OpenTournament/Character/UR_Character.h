@@ -9,8 +9,10 @@
 #include "AbilitySystemInterface.h"
 #include "GameplayCueInterface.h"
 #include "GameplayTagAssetInterface.h"
+#include "Perception/AISightTargetInterface.h"
 
 #include "UR_TeamAgentInterface.h"
+#include "Character/UR_CompactDamageEvent.h"
 #include "Enums/UR_MovementAction.h"
 #include "Enums/UR_Type_DodgeDirection.h"
 #include "Interfaces/UR_TeamInterface.h"
@@ -132,7 +134,8 @@ struct FCharacterVoice
 * Builtin damage events are not replicatable due to struct inheritance & missing reflection.
 * This shall be used for replicating damage numbers, hitsounds, physics impulses, incoming damage on HUD...
 *
-* NOTE: For something like shotgun/flak, we'll need to group up events before replicating.
+* Damage notifications are grouped per victim per frame and sent as FUR_CompactDamageEvent,
+* so one event may stand for several hits (see NumHits).
 */
 USTRUCT(BlueprintType)
 struct FReplicatedDamageEvent
@@ -199,6 +202,12 @@ struct FReplicatedDamageEvent
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     APawn* DamageInstigator;
 
+    /**
+    * Number of hits grouped into this event (shotgun pellets, several splashes in one frame...)
+    */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 NumHits;
+
     FReplicatedDamageEvent()
         : Type(0)
         , Damage(0)
@@ -208,6 +217,7 @@ struct FReplicatedDamageEvent
         , Knockback(0, 0, 0)
         , DamType(nullptr)
         , DamageInstigator(nullptr)
+        , NumHits(1)
     {
     }
 
@@ -249,6 +259,7 @@ class OPENTOURNAMENT_API AUR_Character
     , public IGameplayTagAssetInterface
     , public IUR_TeamInterface
     , public IUR_TeamAgentInterface
+    , public IAISightTargetInterface
 {
     GENERATED_BODY()
 
@@ -378,6 +389,8 @@ public:
 
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     virtual void Tick(float DeltaTime) override;
 
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -678,21 +691,10 @@ public:
     bool DodgeOverride(const FVector& DodgeDir, const FVector& DodgeCross);
 
     /**
-    * Temporary - Set & replicate DodgeDirection.
-    * TODO: implement properly in movement core.
-    * See https://docs.unrealengine.com/en-US/Gameplay/Networking/CharacterMovementComponent/index.html
+    * Set the pending dodge. The movement component sends it to the server with the next saved move.
     */
     UFUNCTION()
     virtual void SetDodgeDirection(const EDodgeDirection InDodgeDirection)
-    {
-        DodgeDirection = InDodgeDirection;
-        ServerSetDodgeDirection(DodgeDirection);
-    }
-
-    UFUNCTION(Server, Reliable)
-    void ServerSetDodgeDirection(const EDodgeDirection InDodgeDirection);
-
-    virtual void ServerSetDodgeDirection_Implementation(const EDodgeDirection InDodgeDirection)
     {
         DodgeDirection = InDodgeDirection;
     }
@@ -732,6 +734,16 @@ public:
 
 #pragma endregion // IGameplayTagAssetInterface
 
+#pragma region IAISightTargetInterface
+    /**
+    * Bot sight checks are answered from the shared bot sensing round (UUR_BotSensingSubsystem) when it checked the pair,
+    * otherwise from a single line trace like the default sight sense.
+    */
+    virtual UAISense_Sight::EVisibilityResult CanBeSeenFrom(const FCanBeSeenFromContext& Context, FVector& OutSeenLocation, int32& OutNumberOfLoSChecksPerformed,
+        int32& OutNumberOfAsyncLosCheckRequested, float& OutSightStrength, int32* UserData = nullptr, const FOnPendingVisibilityQueryProcessedDelegate* Delegate = nullptr) override;
+
+#pragma endregion // IAISightTargetInterface
+
     /**
     * Update Movement GameplayTags pertaining to Physics
     */
@@ -852,8 +864,16 @@ public:
 
     virtual void FellOutOfWorld(const class UDamageType& DamageType) override;
 
-    UFUNCTION(NetMulticast, Unreliable)
-    void MulticastDamageEvent(const FReplicatedDamageEvent RepDamageEvent);
+    /**
+    * Authority only. Groups the damage event with others from the same source this frame.
+    * The groups are sent at the start of next frame to the victim, the instigator and their spectators.
+    */
+    void QueueDamageEvent(const FReplicatedDamageEvent& RepDamageEvent);
+
+    /**
+    * Fire OnDamageReceived on this character and OnDamageDealt on the instigator
+    */
+    void BroadcastDamageEvent(const FReplicatedDamageEvent& RepDamageEvent);
 
     UPROPERTY(BlueprintAssignable, Category = "Character")
     FCharacterDamageEventSignature OnDamageReceived;
@@ -861,6 +881,22 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Character")
     FCharacterDamageEventSignature OnDamageDealt;
 
+protected:
+    /**
+    * Splash damage resolved by FUR_SplashDamageResolver is taken as it is, other radial damage goes through Super.
+    */
+    virtual float InternalTakeRadialDamage(float Damage, FRadialDamageEvent const& RadialDamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
+
+    /**
+    * Send the grouped damage events of last frame to the relevant player controllers
+    */
+    void FlushDamageEvents();
+
+    UPROPERTY(Transient)
+    TArray<FUR_CompactDamageEvent> PendingDamageEvents;
+
+public:
+
     /**
     * Kill this player.
     * Authority only.
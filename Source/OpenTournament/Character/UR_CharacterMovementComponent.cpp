@@ -10,10 +10,14 @@
 #include "AbilitySystemGlobals.h"
 #include "OpenTournament.h"
 #include "UR_Character.h"
+#include "UR_LogChannels.h"
 //#include "UR_PlayerController.h"
 #include "AbilitySystemComponent.h"
 #include "Enums/UR_MovementAction.h"
 #include "Interfaces/UR_WallDodgeSurfaceInterface.h"
+#include "UR_JumpPad.h"
+#include "UR_Lift.h"
+#include "UR_Teleporter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_CharacterMovementComponent)
 
@@ -25,8 +29,173 @@ namespace URCharacter
 {
     static float GroundTraceDistance = 100000.0f;
     FAutoConsoleVariableRef CVar_GroundTraceDistance(TEXT("URCharacter.GroundTraceDistance"), GroundTraceDistance, TEXT("Distance to trace down when generating ground information."), ECVF_Cheat);
+
+    // Dodge direction is packed into FLAG_Custom_0..2 of the compressed move flags
+    static constexpr uint8 DodgeDirectionFlagShift = 4;
+    static constexpr uint8 DodgeDirectionFlagMask = FSavedMove_Character::FLAG_Custom_0 | FSavedMove_Character::FLAG_Custom_1 | FSavedMove_Character::FLAG_Custom_2;
+    static_assert(FSavedMove_Character::FLAG_Custom_0 == (1 << DodgeDirectionFlagShift), "Dodge direction flags must start at FLAG_Custom_0");
+    static_assert(static_cast<uint8>(EDodgeDirection::Down) <= (DodgeDirectionFlagMask >> DodgeDirectionFlagShift), "EDodgeDirection does not fit in the custom move flags");
+
+    static constexpr double CorrectionWindowSeconds = 60.0;
+
+    // How far behind the server clock a client may sample the lift it rides
+    static constexpr double MaxLiftTimeRewind = 1.0;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// FSavedMove_URCharacter
+
+void FSavedMove_URCharacter::Clear()
+{
+    Super::Clear();
+
+    DodgeDirection = EDodgeDirection::None;
+    bStartIsDodging = false;
+    StartDodgeResetTime = 0.f;
+    StartWallDodgeCount = 0;
+    LiftTime = -1.0;
+    StartPendingTeleporter.Reset();
+    StartPendingJumpPad.Reset();
+    StartTeleportExitActor.Reset();
+}
+
+uint8 FSavedMove_URCharacter::GetCompressedFlags() const
+{
+    uint8 Result = Super::GetCompressedFlags();
+    Result |= (static_cast<uint8>(DodgeDirection) << URCharacter::DodgeDirectionFlagShift) & URCharacter::DodgeDirectionFlagMask;
+    return Result;
+}
+
+bool FSavedMove_URCharacter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+    const FSavedMove_URCharacter* NewURMove = static_cast<const FSavedMove_URCharacter*>(NewMove.Get());
+
+    // A dodge must stay on the exact move it was pressed on
+    if (DodgeDirection != EDodgeDirection::None || NewURMove->DodgeDirection != EDodgeDirection::None)
+    {
+        return false;
+    }
+
+    if (bStartIsDodging != NewURMove->bStartIsDodging || StartWallDodgeCount != NewURMove->StartWallDodgeCount)
+    {
+        return false;
+    }
+
+    // Same for teleports and launches
+    if (StartPendingTeleporter.IsValid() || StartPendingJumpPad.IsValid() || NewURMove->StartPendingTeleporter.IsValid() || NewURMove->StartPendingJumpPad.IsValid())
+    {
+        return false;
+    }
+
+    if (StartTeleportExitActor != NewURMove->StartTeleportExitActor)
+    {
+        return false;
+    }
+
+    return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_URCharacter::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation)
+{
+    Super::CombineWith(OldMove, InCharacter, PC, OldStartLocation);
+
+    // The combined move is replayed from the start of the old one, its timers must not count the old move's time twice
+    const FSavedMove_URCharacter* OldURMove = static_cast<const FSavedMove_URCharacter*>(OldMove);
+    bStartIsDodging = OldURMove->bStartIsDodging;
+    StartDodgeResetTime = OldURMove->StartDodgeResetTime;
+    StartWallDodgeCount = OldURMove->StartWallDodgeCount;
+    LiftTime = OldURMove->LiftTime;
+
+    if (UUR_CharacterMovementComponent* MoveComp = Cast<UUR_CharacterMovementComponent>(InCharacter->GetCharacterMovement()))
+    {
+        MoveComp->bIsDodging = bStartIsDodging;
+        MoveComp->DodgeResetTime = StartDodgeResetTime;
+        MoveComp->CurrentWallDodgeCount = StartWallDodgeCount;
+        MoveComp->MoveLiftTime = LiftTime;
+    }
+}
+
+void FSavedMove_URCharacter::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+    Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+    if (const AUR_Character* URCharacter = Cast<AUR_Character>(C))
+    {
+        DodgeDirection = URCharacter->DodgeDirection;
+    }
+
+    if (const UUR_CharacterMovementComponent* MoveComp = Cast<UUR_CharacterMovementComponent>(C->GetCharacterMovement()))
+    {
+        bStartIsDodging = MoveComp->bIsDodging;
+        StartDodgeResetTime = MoveComp->DodgeResetTime;
+        StartWallDodgeCount = MoveComp->CurrentWallDodgeCount;
+        LiftTime = MoveComp->MoveLiftTime;
+        StartPendingTeleporter = MoveComp->PendingTeleporter;
+        StartPendingJumpPad = MoveComp->PendingJumpPad;
+        StartTeleportExitActor = MoveComp->TeleportExitActor;
+    }
+}
+
+void FSavedMove_URCharacter::PrepMoveFor(ACharacter* C)
+{
+    Super::PrepMoveFor(C);
+
+    if (UUR_CharacterMovementComponent* MoveComp = Cast<UUR_CharacterMovementComponent>(C->GetCharacterMovement()))
+    {
+        MoveComp->bIsDodging = bStartIsDodging;
+        MoveComp->DodgeResetTime = StartDodgeResetTime;
+        MoveComp->CurrentWallDodgeCount = StartWallDodgeCount;
+        MoveComp->MoveLiftTime = LiftTime;
+        MoveComp->PendingTeleporter = StartPendingTeleporter;
+        MoveComp->PendingJumpPad = StartPendingJumpPad;
+        MoveComp->TeleportExitActor = StartTeleportExitActor;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// FNetworkPredictionData_Client_URCharacter
+
+FSavedMovePtr FNetworkPredictionData_Client_URCharacter::AllocateNewMove()
+{
+    return FSavedMovePtr(new FSavedMove_URCharacter());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// FURCharacterNetworkMoveData
+
+void FURCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+    Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+    LiftTime = static_cast<const FSavedMove_URCharacter&>(ClientMove).LiftTime;
+}
+
+bool FURCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+    Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+    // Only moves made on a lift pay for the time
+    uint8 bHasLiftTime = LiftTime >= 0.0;
+    Ar.SerializeBits(&bHasLiftTime, 1);
+    if (bHasLiftTime)
+    {
+        Ar << LiftTime;
+    }
+    else if (Ar.IsLoading())
+    {
+        LiftTime = -1.0;
+    }
+
+    return !Ar.IsError();
+}
+
+FURCharacterNetworkMoveDataContainer::FURCharacterNetworkMoveDataContainer()
+{
+    NewMoveData = &URMoveData[0];
+    PendingMoveData = &URMoveData[1];
+    OldMoveData = &URMoveData[2];
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -74,6 +243,8 @@ UUR_CharacterMovementComponent::UUR_CharacterMovementComponent(const class FObje
     NavAgentProps.bCanWalk = true;
 
     bUseFlatBaseForFloorChecks = true;
+
+    SetNetworkMoveDataContainer(URMoveDataContainer);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -275,10 +446,13 @@ void UUR_CharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelT
             }
             else
             {
-                AdjustMovementTimers(1.f * DeltaTime);
                 CurrentServerMoveTime = GetWorld()->GetTimeSeconds();
             }
 
+            // Saved with the move, and sent to the server with it
+            const AUR_Lift* Lift = GetLiftBase();
+            MoveLiftTime = Lift ? Lift->GetLiftTime() : -1.0;
+
             // We need to check the jump state before adjusting input acceleration, to minimize latency
             // and to make sure acceleration respects our potentially new falling state.
             CharacterOwner->CheckJumpInput(DeltaTime);
@@ -330,7 +504,7 @@ void UUR_CharacterMovementComponent::ProcessLanded(const FHitResult& Hit, float
         if (bIsDodging)
         {
             Velocity *= DodgeLandingSpeedScale;
-            DodgeResetTime = GetWorld()->TimeSeconds + DodgeResetInterval; // Get Server adjusted Time
+            DodgeResetTime = DodgeResetInterval;
             bIsDodging = false;
             Owner->UpdateGameplayTags(FGameplayTagContainer{ Owner->GetMovementActionGameplayTag(EMovementAction::Dodging) }, FGameplayTagContainer{ });
         }
@@ -398,9 +572,9 @@ FVector UUR_CharacterMovementComponent::HandleSlopeBoosting(const FVector& Slide
     return Result;
 }
 
-void UUR_CharacterMovementComponent::AdjustMovementTimers(float Adjustment)
+void UUR_CharacterMovementComponent::AdvanceMovementTimers(float DeltaTime)
 {
-    DodgeResetTime -= Adjustment;
+    DodgeResetTime = FMath::Max(DodgeResetTime - DeltaTime, 0.f);
 }
 
 
@@ -416,7 +590,6 @@ void UUR_CharacterMovementComponent::CheckJumpInput(float DeltaTime)
     AUR_Character* URCharacterOwner = Cast<AUR_Character>(CharacterOwner);
     if (URCharacterOwner)
     {
-        const EDodgeDirection DodgeDirection{ URCharacterOwner->DodgeDirection };
         if (CharacterOwner->bPressedJump)
         {
             if ((MovementMode == MOVE_Walking) || (MovementMode == MOVE_Falling))
@@ -435,49 +608,60 @@ void UUR_CharacterMovementComponent::CheckJumpInput(float DeltaTime)
                 // @! TODO edge of water jump
             }
         }
-        else if (DodgeDirection != EDodgeDirection::None)
+    }
+}
+
+void UUR_CharacterMovementComponent::CheckDodgeInput()
+{
+    AUR_Character* URCharacterOwner = Cast<AUR_Character>(CharacterOwner);
+    if (URCharacterOwner == nullptr || CharacterOwner->bPressedJump)
+    {
+        return;
+    }
+
+    const EDodgeDirection DodgeDirection{ URCharacterOwner->DodgeDirection };
+    if (DodgeDirection != EDodgeDirection::None)
+    {
+        // Standard Dodges
+        if (!(DodgeDirection == EDodgeDirection::Up || DodgeDirection == EDodgeDirection::Down))
         {
-            // Standard Dodges
-            if (!(DodgeDirection == EDodgeDirection::Up || DodgeDirection == EDodgeDirection::Down))
-            {
-                const FRotator TurnRot(0.f, CharacterOwner->GetActorRotation().Yaw, 0.f);
-                const FRotationMatrix TurnRotMatrix = FRotationMatrix(TurnRot);
-
-                const float DodgeDirX = (DodgeDirection == EDodgeDirection::Forward)
-                    ? 1.f
-                    : (DodgeDirection == EDodgeDirection::Backward ? -1.f : 0.f);
-                const float DodgeDirY = (DodgeDirection == EDodgeDirection::Left)
-                    ? -1.f
-                    : (DodgeDirection == EDodgeDirection::Right ? 1.f : 0.f);
-                const float DodgeCrossX = (DodgeDirY == 1.f || DodgeDirY == -1.f) ? 1.f : 0.f;
-                const float DodgeCrossY = (DodgeDirX == 1.f || DodgeDirX == -1.f) ? 1.f : 0.f;
-
-                const FVector XAxis = TurnRotMatrix.GetScaledAxis(EAxis::X);
-                const FVector YAxis = TurnRotMatrix.GetScaledAxis(EAxis::Y);
-
-                URCharacterOwner->Dodge((DodgeDirX * XAxis + DodgeDirY * YAxis).GetSafeNormal(),
-                    (DodgeCrossX * XAxis + DodgeCrossY * YAxis).GetSafeNormal());
-            }
-            // Swim Dodges
-            else if (Is3DMovementMode() && (DodgeDirection != EDodgeDirection::Up || DodgeDirection == EDodgeDirection::Down))
-            {
-                const FRotator TurnRot(0.f, CharacterOwner->GetActorRotation().Yaw, 0.f);
-                const FRotationMatrix TurnRotMatrix = FRotationMatrix(TurnRot);
+            const FRotator TurnRot(0.f, CharacterOwner->GetActorRotation().Yaw, 0.f);
+            const FRotationMatrix TurnRotMatrix = FRotationMatrix(TurnRot);
+
+            const float DodgeDirX = (DodgeDirection == EDodgeDirection::Forward)
+                ? 1.f
+                : (DodgeDirection == EDodgeDirection::Backward ? -1.f : 0.f);
+            const float DodgeDirY = (DodgeDirection == EDodgeDirection::Left)
+                ? -1.f
+                : (DodgeDirection == EDodgeDirection::Right ? 1.f : 0.f);
+            const float DodgeCrossX = (DodgeDirY == 1.f || DodgeDirY == -1.f) ? 1.f : 0.f;
+            const float DodgeCrossY = (DodgeDirX == 1.f || DodgeDirX == -1.f) ? 1.f : 0.f;
+
+            const FVector XAxis = TurnRotMatrix.GetScaledAxis(EAxis::X);
+            const FVector YAxis = TurnRotMatrix.GetScaledAxis(EAxis::Y);
+
+            URCharacterOwner->Dodge((DodgeDirX * XAxis + DodgeDirY * YAxis).GetSafeNormal(),
+                (DodgeCrossX * XAxis + DodgeCrossY * YAxis).GetSafeNormal());
+        }
+        // Swim Dodges
+        else if (Is3DMovementMode() && (DodgeDirection != EDodgeDirection::Up || DodgeDirection == EDodgeDirection::Down))
+        {
+            const FRotator TurnRot(0.f, CharacterOwner->GetActorRotation().Yaw, 0.f);
+            const FRotationMatrix TurnRotMatrix = FRotationMatrix(TurnRot);
 
-                const float DodgeDirX = 0.f;
-                const float DodgeDirZ = (DodgeDirection == EDodgeDirection::Up)
-                    ? 1.f
-                    : (DodgeDirection == EDodgeDirection::Down ? -1.f : 0.f);
+            const float DodgeDirX = 0.f;
+            const float DodgeDirZ = (DodgeDirection == EDodgeDirection::Up)
+                ? 1.f
+                : (DodgeDirection == EDodgeDirection::Down ? -1.f : 0.f);
 
-                const float DodgeCrossX = (DodgeDirZ == 1.f || DodgeDirZ == -1.f) ? 1.f : 0.f;
-                const float DodgeCrossZ = 0.f;
+            const float DodgeCrossX = (DodgeDirZ == 1.f || DodgeDirZ == -1.f) ? 1.f : 0.f;
+            const float DodgeCrossZ = 0.f;
 
-                const FVector XAxis = TurnRotMatrix.GetScaledAxis(EAxis::X);
-                const FVector ZAxis = TurnRotMatrix.GetScaledAxis(EAxis::Z);
+            const FVector XAxis = TurnRotMatrix.GetScaledAxis(EAxis::X);
+            const FVector ZAxis = TurnRotMatrix.GetScaledAxis(EAxis::Z);
 
-                URCharacterOwner->Dodge((DodgeDirX * XAxis + DodgeDirZ * ZAxis).GetSafeNormal(),
-                    (DodgeCrossX * XAxis + DodgeCrossZ * ZAxis).GetSafeNormal());
-            }
+            URCharacterOwner->Dodge((DodgeDirX * XAxis + DodgeDirZ * ZAxis).GetSafeNormal(),
+                (DodgeCrossX * XAxis + DodgeCrossZ * ZAxis).GetSafeNormal());
         }
     }
 }
@@ -524,7 +708,11 @@ bool UUR_CharacterMovementComponent::PerformDodge(const FVector& DodgeDir, const
         bNotifyApex = true;
         SetMovementMode(MOVE_Falling);
 
-        URCharacterOwner->OnDodge(URCharacterOwner->GetActorLocation(), Velocity);
+        // Don't repeat effects when replaying moves after a correction
+        if (!CharacterOwner->bClientUpdating)
+        {
+            URCharacterOwner->OnDodge(URCharacterOwner->GetActorLocation(), Velocity);
+        }
     }
     else if (IsFalling())
     {
@@ -543,7 +731,7 @@ bool UUR_CharacterMovementComponent::PerformDodge(const FVector& DodgeDir, const
             FVector WallDodgeCross = DodgeCross;
             SetWallDodgeDirection(WallDodgeDirection, WallDodgeCross, HitResult);
 
-            DodgeResetTime = GetWorld()->TimeSeconds + WallDodgeResetInterval;
+            DodgeResetTime = WallDodgeResetInterval;
             CurrentWallDodgeCount++;
 
             // Trigger Falling Damage, if any
@@ -551,7 +739,10 @@ bool UUR_CharacterMovementComponent::PerformDodge(const FVector& DodgeDir, const
 
             PerformWallDodgeImpulse(WallDodgeDirection, WallDodgeCross);
 
-            URCharacterOwner->OnWallDodge(URCharacterOwner->GetActorLocation(), Velocity);
+            if (!CharacterOwner->bClientUpdating)
+            {
+                URCharacterOwner->OnWallDodge(URCharacterOwner->GetActorLocation(), Velocity);
+            }
         }
     }
     else if (IsSwimming())
@@ -562,7 +753,10 @@ bool UUR_CharacterMovementComponent::PerformDodge(const FVector& DodgeDir, const
         bIsDodging = true;
         bNotifyApex = true;
 
-        URCharacterOwner->OnDodge(URCharacterOwner->GetActorLocation(), Velocity);
+        if (!CharacterOwner->bClientUpdating)
+        {
+            URCharacterOwner->OnDodge(URCharacterOwner->GetActorLocation(), Velocity);
+        }
         // @! TODO Swim Dodge needs its own DodgeReset time value or have a timer that resets a dodge
     }
 
@@ -689,6 +883,161 @@ void UUR_CharacterMovementComponent::ClearDodgeInput()
     }
 }
 
+FNetworkPredictionData_Client* UUR_CharacterMovementComponent::GetPredictionData_Client() const
+{
+    if (ClientPredictionData == nullptr)
+    {
+        UUR_CharacterMovementComponent* MutableThis = const_cast<UUR_CharacterMovementComponent*>(this);
+        MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_URCharacter(*this);
+    }
+
+    return ClientPredictionData;
+}
+
+void UUR_CharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+    Super::UpdateFromCompressedFlags(Flags);
+
+    if (AUR_Character* URCharacterOwner = Cast<AUR_Character>(CharacterOwner))
+    {
+        const uint8 DodgeDirectionValue = (Flags & URCharacter::DodgeDirectionFlagMask) >> URCharacter::DodgeDirectionFlagShift;
+        URCharacterOwner->DodgeDirection = (DodgeDirectionValue <= static_cast<uint8>(EDodgeDirection::Down))
+            ? static_cast<EDodgeDirection>(DodgeDirectionValue)
+            : EDodgeDirection::None;
+    }
+}
+
+void UUR_CharacterMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+    // Clients cannot sample the lift ahead of the server, nor arbitrarily far behind it
+    const FURCharacterNetworkMoveData* MoveData = static_cast<const FURCharacterNetworkMoveData*>(GetCurrentNetworkMoveData());
+    const AUR_Lift* Lift = GetLiftBase();
+    if (MoveData && Lift && MoveData->LiftTime >= 0.0)
+    {
+        const double ServerLiftTime = Lift->GetLiftTime();
+        MoveLiftTime = FMath::Clamp(MoveData->LiftTime, ServerLiftTime - URCharacter::MaxLiftTimeRewind, ServerLiftTime);
+    }
+    else
+    {
+        MoveLiftTime = -1.0;
+    }
+
+    Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+void UUR_CharacterMovementComponent::PerformMovement(float DeltaTime)
+{
+    // Put the lift where it was at the time of the move before based movement follows it,
+    // and back right after so other riders and overlaps keep seeing the real lift
+    AUR_Lift* SampledLift = (MoveLiftTime >= 0.0) ? GetLiftBase() : nullptr;
+    if (SampledLift)
+    {
+        SampledLift->SampleLiftAtTime(MoveLiftTime);
+    }
+
+    Super::PerformMovement(DeltaTime);
+
+    if (SampledLift)
+    {
+        SampledLift->RestoreSampledLift();
+    }
+}
+
+AUR_Lift* UUR_CharacterMovementComponent::GetLiftBase() const
+{
+    const UPrimitiveComponent* Base = GetMovementBase();
+    return Base ? Cast<AUR_Lift>(Base->GetOwner()) : nullptr;
+}
+
+void UUR_CharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+    Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+    AdvanceMovementTimers(DeltaSeconds);
+
+    ProcessPendingMovementEvents();
+
+    // Jump input is cleared right after this, in PerformMovement
+    CheckDodgeInput();
+}
+
+void UUR_CharacterMovementComponent::RequestTeleport(AUR_Teleporter* Teleporter)
+{
+    PendingTeleporter = Teleporter;
+}
+
+void UUR_CharacterMovementComponent::RequestJumpPadLaunch(AUR_JumpPad* JumpPad)
+{
+    PendingJumpPad = JumpPad;
+}
+
+void UUR_CharacterMovementComponent::ProcessPendingMovementEvents()
+{
+    if (AUR_Teleporter* Teleporter = PendingTeleporter.Get())
+    {
+        PendingTeleporter.Reset();
+        Teleporter->InternalTeleport(CharacterOwner);
+    }
+
+    // Launch velocity is applied by HandlePendingLaunch later in this same move
+    if (AUR_JumpPad* JumpPad = PendingJumpPad.Get())
+    {
+        PendingJumpPad.Reset();
+        JumpPad->LaunchCharacter(CharacterOwner);
+    }
+}
+
+bool UUR_CharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+    // Replayed moves overwrite the dodge input from their flags, keep the input pending for the next move
+    AUR_Character* URCharacterOwner = Cast<AUR_Character>(CharacterOwner);
+    const EDodgeDirection PendingDodgeDirection = URCharacterOwner ? URCharacterOwner->DodgeDirection : EDodgeDirection::None;
+
+    const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+
+    if (URCharacterOwner)
+    {
+        URCharacterOwner->DodgeDirection = PendingDodgeDirection;
+    }
+
+    return bResult;
+}
+
+void UUR_CharacterMovementComponent::SendClientAdjustment()
+{
+    const FNetworkPredictionData_Server_Character* ServerData = HasPredictionData_Server() ? GetPredictionData_Server_Character() : nullptr;
+    if (ServerData && ServerData->PendingAdjustment.TimeStamp > 0.f && !ServerData->PendingAdjustment.bAckGoodMove)
+    {
+        const double Now = GetWorld()->GetRealTimeSeconds();
+        if (Now - CorrectionMinuteStartTime >= URCharacter::CorrectionWindowSeconds)
+        {
+            // Roll the window, a full idle minute in between means the last minute had none
+            CorrectionsLastMinute = (Now - CorrectionMinuteStartTime < 2.0 * URCharacter::CorrectionWindowSeconds) ? CorrectionsThisMinute : 0;
+            CorrectionsThisMinute = 0;
+            CorrectionMinuteStartTime = Now;
+        }
+
+        ++NumClientCorrections;
+        ++CorrectionsThisMinute;
+
+        UE_LOG(LogGame, Verbose, TEXT("%s: Correcting client move %f (%d corrections)"), *GetNameSafe(CharacterOwner), ServerData->PendingAdjustment.TimeStamp, NumClientCorrections);
+    }
+
+    Super::SendClientAdjustment();
+}
+
+int32 UUR_CharacterMovementComponent::GetClientCorrectionsPerMinute() const
+{
+    const double Elapsed = GetWorld() ? GetWorld()->GetRealTimeSeconds() - CorrectionMinuteStartTime : 0.0;
+    if (Elapsed < URCharacter::CorrectionWindowSeconds)
+    {
+        // Current minute is incomplete, report whichever is worse
+        return FMath::Max(CorrectionsLastMinute, CorrectionsThisMinute);
+    }
+
+    return (Elapsed < 2.0 * URCharacter::CorrectionWindowSeconds) ? CorrectionsThisMinute : 0;
+}
+
 void UUR_CharacterMovementComponent::SimulateMovement(float DeltaTime)
 {
     if (bHasReplicatedAcceleration)
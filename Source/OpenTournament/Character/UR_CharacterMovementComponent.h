@@ -8,10 +8,18 @@
 
 #include "NativeGameplayTags.h"
 
+#include "Enums/UR_Type_DodgeDirection.h"
+
 #include "UR_CharacterMovementComponent.generated.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+class AUR_JumpPad;
+class AUR_Lift;
+class AUR_Teleporter;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 UENUM(BlueprintType)
 enum class EWallDodgeBehavior : uint8
 {
@@ -47,6 +55,76 @@ OPENTOURNAMENT_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Gameplay_MovementStopped);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+* Saved move carrying the dodge input, and the dodge state needed to replay it after a correction
+*/
+class OPENTOURNAMENT_API FSavedMove_URCharacter : public FSavedMove_Character
+{
+public:
+    typedef FSavedMove_Character Super;
+
+    virtual void Clear() override;
+    virtual uint8 GetCompressedFlags() const override;
+    virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+    virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation) override;
+    virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+    virtual void PrepMoveFor(ACharacter* C) override;
+
+    // Pending dodge input, sent in the FLAG_Custom_0..2 bits
+    EDodgeDirection DodgeDirection = EDodgeDirection::None;
+
+    // Dodge state at the start of the move
+    bool bStartIsDodging = false;
+    float StartDodgeResetTime = 0.f;
+    int32 StartWallDodgeCount = 0;
+
+    // Server world time the lift under the character is sampled at for this move, negative when not on a lift
+    double LiftTime = -1.0;
+
+    // Movement events and teleporter state at the start of the move
+    TWeakObjectPtr<AUR_Teleporter> StartPendingTeleporter;
+    TWeakObjectPtr<AUR_JumpPad> StartPendingJumpPad;
+    TWeakObjectPtr<AActor> StartTeleportExitActor;
+};
+
+/**
+* Client prediction data allocating FSavedMove_URCharacter
+*/
+class OPENTOURNAMENT_API FNetworkPredictionData_Client_URCharacter : public FNetworkPredictionData_Client_Character
+{
+public:
+    typedef FNetworkPredictionData_Client_Character Super;
+
+    FNetworkPredictionData_Client_URCharacter(const UCharacterMovementComponent& ClientMovement)
+        : Super(ClientMovement)
+    {
+    }
+
+    virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+* Network move data also sending the lift time of the move
+*/
+struct OPENTOURNAMENT_API FURCharacterNetworkMoveData : public FCharacterNetworkMoveData
+{
+    typedef FCharacterNetworkMoveData Super;
+
+    virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+    virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+
+    double LiftTime = -1.0;
+};
+
+struct OPENTOURNAMENT_API FURCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+    FURCharacterNetworkMoveDataContainer();
+
+    FURCharacterNetworkMoveData URMoveData[3];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 
 
 /**
@@ -139,9 +217,10 @@ public:
     }
 
     /**
-    * Adjust movement timers if timestamp was reset
+    * Advance movement timers by the duration of the move being performed.
+    * Timers count down in move time so they replay identically on client and server.
     */
-    void AdjustMovementTimers(float Adjustment);
+    void AdvanceMovementTimers(float DeltaTime);
 
     /**
     * Time the server is using for this move, from client's timestamp
@@ -225,7 +304,7 @@ public:
     uint8 bIsDodging : 1;
 
     /**
-    * Timestamp of next time a character may dodge
+    * Move time remaining until the character may dodge again
     */
     UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Dodging")
     float DodgeResetTime;
@@ -364,6 +443,64 @@ public:
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    // Network Prediction
+
+    //~UCharacterMovementComponent interface
+    virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+    virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+    virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+    virtual bool ClientUpdatePositionAfterServerUpdate() override;
+    virtual void SendClientAdjustment() override;
+    virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+    //~End of UCharacterMovementComponent interface
+
+    /**
+    * Process a pending dodge. Runs inside the move so it is replayed with it.
+    */
+    void CheckDodgeInput();
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    // Movement Events
+
+    /**
+    * Queue a teleport through Teleporter. It is performed at the start of the next move,
+    * so client, server and replayed moves all teleport on the same move.
+    */
+    void RequestTeleport(AUR_Teleporter* Teleporter);
+
+    /**
+    * Queue a launch from JumpPad, performed at the start of the next move
+    */
+    void RequestJumpPadLaunch(AUR_JumpPad* JumpPad);
+
+    /**
+    * Perform movement events queued during the previous move
+    */
+    void ProcessPendingMovementEvents();
+
+    /**
+    * Teleporter we arrived at, ignored until we leave it
+    */
+    AActor* GetTeleportExitActor() const { return TeleportExitActor.Get(); }
+
+    void SetTeleportExitActor(AActor* InActor) { TeleportExitActor = InActor; }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /**
+    * Number of position corrections the server sent to the owning client during the last minute
+    */
+    UFUNCTION(BlueprintCallable, Category = "Character|Network")
+    int32 GetClientCorrectionsPerMinute() const;
+
+    /**
+    * Number of position corrections the server sent to the owning client since spawn
+    */
+    int32 GetNumClientCorrections() const { return NumClientCorrections; }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+
     virtual void SimulateMovement(float DeltaTime) override;
 
     virtual bool CanAttemptJump() const override;
@@ -381,10 +518,38 @@ public:
 
 protected:
 
+    //~UCharacterMovementComponent interface
+    virtual void PerformMovement(float DeltaTime) override;
+    //~End of UCharacterMovementComponent interface
+
     // Cached ground info for the character.  Do not access this directly!  It's only updated when accessed via GetGroundInfo().
     FUR_CharacterGroundInfo CachedGroundInfo;
 
     UPROPERTY(Transient)
     bool bHasReplicatedAcceleration = false;
 
+private:
+    friend FSavedMove_URCharacter;
+
+    TWeakObjectPtr<AUR_Teleporter> PendingTeleporter;
+    TWeakObjectPtr<AUR_JumpPad> PendingJumpPad;
+    TWeakObjectPtr<AActor> TeleportExitActor;
+
+    // Lift the character is based on, if any
+    AUR_Lift* GetLiftBase() const;
+
+    /**
+    * Server world time the lift under the character is sampled at for the current move, negative when not on a lift.
+    * Taken from the local clock when the move is made, sent with it, and restored when it is replayed, so the server and
+    * the client move the rider on the same lift position.
+    */
+    double MoveLiftTime = -1.0;
+
+    FURCharacterNetworkMoveDataContainer URMoveDataContainer;
+
+    int32 NumClientCorrections = 0;
+    int32 CorrectionsThisMinute = 0;
+    int32 CorrectionsLastMinute = 0;
+    double CorrectionMinuteStartTime = 0.0;
+
 };
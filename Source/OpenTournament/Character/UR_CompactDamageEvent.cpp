@@ -0,0 +1,127 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_CompactDamageEvent.h"
+
+#include "Engine/DamageEvents.h"
+#include "UObject/CoreNet.h"
+
+#include "UR_Character.h"
+#include "UR_DamageType.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_CompactDamageEvent)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace URCompactDamageEvent
+{
+    static void SerializeDamageValue(FArchive& Ar, int32& Value)
+    {
+        uint32 Packed = static_cast<uint32>(FMath::Clamp(Value, 0, static_cast<int32>(MAX_uint16)));
+        Ar.SerializeIntPacked(Packed);
+        Value = static_cast<int32>(Packed);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+FUR_CompactDamageEvent FUR_CompactDamageEvent::Make(AUR_Character* InVictim, const FReplicatedDamageEvent& RepDamageEvent)
+{
+    FUR_CompactDamageEvent Event;
+    Event.Victim = InVictim;
+    Event.DamageInstigator = RepDamageEvent.DamageInstigator;
+    Event.DamType = RepDamageEvent.DamType;
+    Event.Type = static_cast<uint8>(RepDamageEvent.Type);
+    Event.NumHits = 1;
+    Event.Damage = RepDamageEvent.Damage;
+    Event.HealthDamage = RepDamageEvent.HealthDamage;
+    Event.ArmorDamage = RepDamageEvent.ArmorDamage;
+    Event.Location = RepDamageEvent.Location;
+    Event.Knockback = RepDamageEvent.Knockback;
+    return Event;
+}
+
+FReplicatedDamageEvent FUR_CompactDamageEvent::ToReplicatedDamageEvent() const
+{
+    FReplicatedDamageEvent RepDamageEvent;
+    RepDamageEvent.Type = Type;
+    RepDamageEvent.Damage = Damage;
+    RepDamageEvent.HealthDamage = HealthDamage;
+    RepDamageEvent.ArmorDamage = ArmorDamage;
+    RepDamageEvent.Location = Location;
+    RepDamageEvent.Knockback = Knockback;
+    RepDamageEvent.DamType = DamType ? DamType.Get() : GetDefault<UUR_DamageType>();
+    RepDamageEvent.DamageInstigator = DamageInstigator;
+    RepDamageEvent.NumHits = NumHits;
+    return RepDamageEvent;
+}
+
+bool FUR_CompactDamageEvent::TryMerge(const FUR_CompactDamageEvent& Other)
+{
+    if (Victim != Other.Victim || DamageInstigator != Other.DamageInstigator || DamType != Other.DamType || Type != Other.Type)
+    {
+        return false;
+    }
+
+    if (NumHits > MAX_uint8 - Other.NumHits)
+    {
+        return false;
+    }
+
+    NumHits += Other.NumHits;
+    Damage += Other.Damage;
+    HealthDamage += Other.HealthDamage;
+    ArmorDamage += Other.ArmorDamage;
+    Location = Other.Location;
+
+    if (Type == FRadialDamageEvent::ClassID)
+    {
+        // Radial knockback is (KnockbackPower, Radius, 0), not a direction
+        Knockback = Knockback.ComponentMax(Other.Knockback);
+    }
+    else
+    {
+        // Keeps the combined shot direction
+        Knockback += Other.Knockback;
+    }
+
+    return true;
+}
+
+bool FUR_CompactDamageEvent::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = true;
+
+    UObject* VictimObject = Victim;
+    UObject* InstigatorObject = DamageInstigator;
+    UObject* DamTypeObject = const_cast<UUR_DamageType*>(DamType.Get());
+
+    bOutSuccess &= Map->SerializeObject(Ar, AUR_Character::StaticClass(), VictimObject);
+    bOutSuccess &= Map->SerializeObject(Ar, APawn::StaticClass(), InstigatorObject);
+    bOutSuccess &= Map->SerializeObject(Ar, UUR_DamageType::StaticClass(), DamTypeObject);
+
+    if (Ar.IsLoading())
+    {
+        Victim = Cast<AUR_Character>(VictimObject);
+        DamageInstigator = Cast<APawn>(InstigatorObject);
+        DamType = Cast<UUR_DamageType>(DamTypeObject);
+        Type = 0;
+    }
+
+    // Point = 1, Radial = 2
+    Ar.SerializeBits(&Type, 2);
+    Ar << NumHits;
+
+    URCompactDamageEvent::SerializeDamageValue(Ar, Damage);
+    URCompactDamageEvent::SerializeDamageValue(Ar, HealthDamage);
+    URCompactDamageEvent::SerializeDamageValue(Ar, ArmorDamage);
+
+    bool bVectorSuccess = true;
+    Location.NetSerialize(Ar, Map, bVectorSuccess);
+    bOutSuccess &= bVectorSuccess;
+    Knockback.NetSerialize(Ar, Map, bVectorSuccess);
+    bOutSuccess &= bVectorSuccess;
+
+    return true;
+}
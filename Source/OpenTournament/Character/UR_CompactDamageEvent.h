@@ -0,0 +1,70 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Engine/NetSerialization.h"
+
+#include "UR_CompactDamageEvent.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class APawn;
+class AUR_Character;
+class UUR_DamageType;
+struct FReplicatedDamageEvent;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+* Network form of FReplicatedDamageEvent.
+* Hits from the same instigator with the same damage type are merged into one event per victim per frame
+* (shotgun pellets, splash on several body parts...), and sent quantized to the connections that care.
+*/
+USTRUCT()
+struct FUR_CompactDamageEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<AUR_Character> Victim = nullptr;
+
+    UPROPERTY()
+    TObjectPtr<APawn> DamageInstigator = nullptr;
+
+    UPROPERTY()
+    TObjectPtr<const UUR_DamageType> DamType = nullptr;
+
+    // Builtin DamageEvent.ClassID, see FReplicatedDamageEvent::Type
+    uint8 Type = 0;
+
+    // Number of damage instances merged into this event
+    uint8 NumHits = 0;
+
+    // Damage values are sent clamped to 0..MAX_uint16
+    int32 Damage = 0;
+    int32 HealthDamage = 0;
+    int32 ArmorDamage = 0;
+
+    FVector_NetQuantize Location = FVector::ZeroVector;
+    FVector_NetQuantize10 Knockback = FVector::ZeroVector;
+
+    static FUR_CompactDamageEvent Make(AUR_Character* InVictim, const FReplicatedDamageEvent& RepDamageEvent);
+
+    FReplicatedDamageEvent ToReplicatedDamageEvent() const;
+
+    /** Merge Other into this event if both come from the same source, returns false if they cannot be merged */
+    bool TryMerge(const FUR_CompactDamageEvent& Other);
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FUR_CompactDamageEvent> : public TStructOpsTypeTraitsBase2<FUR_CompactDamageEvent>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
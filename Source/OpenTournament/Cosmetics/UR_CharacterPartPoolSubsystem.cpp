@@ -0,0 +1,208 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_CharacterPartPoolSubsystem.h"
+
+#include "Animation/Skeleton.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "SkeletalMergingLibrary.h"
+
+#include "UR_LogChannels.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_CharacterPartPoolSubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static int32 CharacterPartPoolSize = 16;
+    static FAutoConsoleVariableRef CVarCharacterPartPoolSize
+    (
+        TEXT("OT.Cosmetics.PartPoolSize"),
+        CharacterPartPoolSize,
+        TEXT("Maximum number of released character part actors kept for reuse, per part class."),
+        ECVF_Default
+    );
+
+    static FAutoConsoleCommandWithWorld CVarDumpCharacterPartStats
+    (
+        TEXT("OT.Cosmetics.DumpPartStats"),
+        TEXT("Shows how many character part spawns were avoided by pooling, and what merging part meshes saved."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (const UUR_CharacterPartPoolSubsystem* PartPool = UWorld::GetSubsystem<UUR_CharacterPartPoolSubsystem>(World))
+            {
+                PartPool->DumpStats();
+            }
+        })
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_CharacterPartPoolSubsystem::Deinitialize()
+{
+    PooledActors.Empty();
+    MergedMeshesByKey.Empty();
+    MergedMeshes.Empty();
+
+    Super::Deinitialize();
+}
+
+AActor* UUR_CharacterPartPoolSubsystem::AcquirePartActor(TSubclassOf<AActor> PartClass, AActor* Owner)
+{
+    if (PartClass == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (TArray<TWeakObjectPtr<AActor>>* Pool = PooledActors.Find(PartClass.Get()))
+    {
+        while (Pool->Num() > 0)
+        {
+            if (AActor* PartActor = Pool->Pop(EAllowShrinking::No).Get())
+            {
+                PartActor->SetOwner(Owner);
+                PartActor->SetActorHiddenInGame(false);
+                PartActor->SetActorEnableCollision(true);
+                Stats.NumReused++;
+                return PartActor;
+            }
+        }
+    }
+
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = Owner;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    SpawnParams.ObjectFlags |= RF_Transient;
+
+    const double StartTime = FPlatformTime::Seconds();
+    AActor* PartActor = World->SpawnActor<AActor>(PartClass, FTransform::Identity, SpawnParams);
+    Stats.SpawnSeconds += FPlatformTime::Seconds() - StartTime;
+    Stats.NumSpawned++;
+
+    return PartActor;
+}
+
+void UUR_CharacterPartPoolSubsystem::ReleasePartActor(AActor* PartActor)
+{
+    if (!IsValid(PartActor))
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<AActor>>& Pool = PooledActors.FindOrAdd(PartActor->GetClass());
+    Pool.RemoveAll([](const TWeakObjectPtr<AActor>& Pooled) { return !Pooled.IsValid(); });
+
+    if (Pool.Num() >= OTConsoleVariables::CharacterPartPoolSize || PartActor->GetWorld() != GetWorld())
+    {
+        PartActor->Destroy();
+        Stats.NumDestroyed++;
+        return;
+    }
+
+    PartActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    PartActor->SetActorHiddenInGame(true);
+    PartActor->SetActorEnableCollision(false);
+    PartActor->SetOwner(nullptr);
+
+    // Back to the part's defaults, the next wearer applies its own leader and material overrides
+    TInlineComponentArray<USkeletalMeshComponent*> PartMeshes(PartActor);
+    for (USkeletalMeshComponent* PartMesh : PartMeshes)
+    {
+        PartMesh->SetLeaderPoseComponent(nullptr);
+        PartMesh->SetVisibility(true);
+        PartMesh->EmptyOverrideMaterials();
+        if (const USkeletalMeshComponent* Archetype = Cast<USkeletalMeshComponent>(PartMesh->GetArchetype()))
+        {
+            for (int32 i = 0; i < Archetype->OverrideMaterials.Num(); i++)
+            {
+                PartMesh->SetMaterial(i, Archetype->OverrideMaterials[i]);
+            }
+        }
+    }
+
+    Pool.Add(PartActor);
+}
+
+USkeletalMesh* UUR_CharacterPartPoolSubsystem::GetMergedMesh(const TArray<USkeletalMesh*>& Meshes, USkeleton* Skeleton)
+{
+    if (Meshes.Num() < 2 || Skeleton == nullptr)
+    {
+        return nullptr;
+    }
+
+    FString Key = Skeleton->GetPathName();
+    for (const USkeletalMesh* Mesh : Meshes)
+    {
+        Key += TEXT("|");
+        Key += GetPathNameSafe(Mesh);
+    }
+
+    if (const TObjectPtr<USkeletalMesh>* Cached = MergedMeshesByKey.Find(Key))
+    {
+        return *Cached;
+    }
+
+    FSkeletalMeshMergeParams MergeParams;
+    MergeParams.MeshesToMerge.Append(Meshes);
+    MergeParams.Skeleton = Skeleton;
+    MergeParams.bNeedsCpuAccess = false;
+
+    // Synchronous, on the game thread. Only paid once per combination thanks to the cache above.
+    USkeletalMesh* MergedMesh = USkeletalMergingLibrary::MergeMeshes(MergeParams);
+    if (MergedMesh)
+    {
+        MergedMeshes.Add(MergedMesh);
+        Stats.NumMergedMeshesBuilt++;
+    }
+    else
+    {
+        // Typically source meshes without CPU access in cooked builds, those parts simply stay separate
+        UE_LOG(LogGame, Verbose, TEXT("Could not merge character part meshes %s"), *Key);
+        Stats.NumMergeFailures++;
+    }
+
+    MergedMeshesByKey.Add(MoveTemp(Key), MergedMesh);
+    return MergedMesh;
+}
+
+void UUR_CharacterPartPoolSubsystem::RecordMergedParts(int32 NumComponents, int32 NumSectionsBefore, int32 NumSectionsAfter)
+{
+    Stats.NumComponentsMerged += NumComponents;
+    Stats.NumComponentsDrawn++;
+    Stats.NumSectionsBefore += NumSectionsBefore;
+    Stats.NumSectionsAfter += NumSectionsAfter;
+}
+
+int32 UUR_CharacterPartPoolSubsystem::GetNumPooledActors() const
+{
+    int32 NumPooled = 0;
+    for (const TPair<TObjectKey<UClass>, TArray<TWeakObjectPtr<AActor>>>& Pair : PooledActors)
+    {
+        NumPooled += Pair.Value.Num();
+    }
+    return NumPooled;
+}
+
+void UUR_CharacterPartPoolSubsystem::DumpStats() const
+{
+    const int32 NumPooled = GetNumPooledActors();
+    const double AverageSpawnMs = Stats.NumSpawned > 0 ? 1000.0 * Stats.SpawnSeconds / Stats.NumSpawned : 0.0;
+
+    UE_LOG(LogGame, Log, TEXT("Character parts: %d spawned (%.3f ms avg), %d reused from pool (~%.2f ms of spawning saved), %d destroyed, %d pooled"),
+        Stats.NumSpawned, AverageSpawnMs, Stats.NumReused, Stats.NumReused * AverageSpawnMs, Stats.NumDestroyed, NumPooled);
+
+    UE_LOG(LogGame, Log, TEXT("Character part merging: %d meshes built, %d failed. %d part components drawn as %d, mesh sections (draw calls per view) %d -> %d"),
+        Stats.NumMergedMeshesBuilt, Stats.NumMergeFailures, Stats.NumComponentsMerged, Stats.NumComponentsDrawn,
+        Stats.NumSectionsBefore, Stats.NumSectionsAfter);
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "UR_CharacterPartPoolSubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+class USkeletalMesh;
+class USkeleton;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Keeps character part actors around across respawns and cosmetic changes, and builds merged part meshes.
+ *
+ * Released part actors are detached, hidden and stored per class (up to OT.Cosmetics.PartPoolSize each),
+ * then handed out again instead of spawning new ones.
+ * Merged meshes are built once per combination of part meshes and shared by every pawn wearing it.
+ *
+ * OT.Cosmetics.DumpPartStats reports the spawns avoided and the mesh components / sections saved by merging.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_CharacterPartPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~USubsystem interface
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    // Returns a visible, detached part actor of PartClass, reused from the pool when possible
+    AActor* AcquirePartActor(TSubclassOf<AActor> PartClass, AActor* Owner);
+
+    // Hands a part actor back, it is destroyed instead if the pool of its class is full
+    void ReleasePartActor(AActor* PartActor);
+
+    // Returns the merge of Meshes (in order) on Skeleton, or nullptr if they cannot be merged.
+    // A new combination is merged synchronously on the game thread (USkeletalMergingLibrary::MergeMeshes), expect a hitch.
+    USkeletalMesh* GetMergedMesh(const TArray<USkeletalMesh*>& Meshes, USkeleton* Skeleton);
+
+    // Records that NumComponents part meshes are drawn as one
+    void RecordMergedParts(int32 NumComponents, int32 NumSectionsBefore, int32 NumSectionsAfter);
+
+    // Number of part actors waiting in the pool to be reused
+    int32 GetNumPooledActors() const;
+
+    void DumpStats() const;
+
+private:
+    struct FStats
+    {
+        int32 NumSpawned = 0;
+        int32 NumReused = 0;
+        int32 NumDestroyed = 0;
+        double SpawnSeconds = 0.0;
+
+        int32 NumMergedMeshesBuilt = 0;
+        int32 NumMergeFailures = 0;
+        int32 NumComponentsMerged = 0;
+        int32 NumComponentsDrawn = 0;
+        int32 NumSectionsBefore = 0;
+        int32 NumSectionsAfter = 0;
+    };
+
+    TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AActor>>> PooledActors;
+
+    // Combination of mesh paths -> merged mesh, failed merges are cached as nullptr
+    TMap<FString, TObjectPtr<USkeletalMesh>> MergedMeshesByKey;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<USkeletalMesh>> MergedMeshes;
+
+    FStats Stats;
+};
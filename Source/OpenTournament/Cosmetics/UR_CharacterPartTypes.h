@@ -11,7 +11,6 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-class UChildActorComponent;
 class UUR_PawnComponent_CharacterParts;
 struct FUR_CharacterPartList;
 
@@ -5,10 +5,15 @@
 #include "Cosmetics/UR_PawnComponent_CharacterParts.h"
 
 #include "GameplayTagAssetInterface.h"
+#include "Animation/Skeleton.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "Net/UnrealNetwork.h"
+#include "Rendering/SkeletalMeshRenderData.h"
 
+#include "Cosmetics/UR_CharacterPartPoolSubsystem.h"
 #include "Cosmetics/UR_CharacterPartTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_PawnComponent_CharacterParts)
@@ -22,9 +27,38 @@ class UWorld;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace OTConsoleVariables
+{
+    static bool bMergeCharacterPartMeshes = true;
+    static FAutoConsoleVariableRef CVarMergeCharacterPartMeshes
+    (
+        TEXT("OT.Cosmetics.MergePartMeshes"),
+        bMergeCharacterPartMeshes,
+        TEXT("Merge character part meshes sharing the body skeleton into a single skeletal mesh. Applies on next part change."),
+        ECVF_Default
+    );
+}
+
+namespace URCharacterParts
+{
+    static const USkeleton* GetSkeleton(const USkeletalMeshComponent* MeshComponent)
+    {
+        const USkeletalMesh* Mesh = MeshComponent ? MeshComponent->GetSkeletalMeshAsset() : nullptr;
+        return Mesh ? Mesh->GetSkeleton() : nullptr;
+    }
+
+    static int32 GetNumSections(const USkeletalMesh* Mesh)
+    {
+        const FSkeletalMeshRenderData* RenderData = Mesh ? Mesh->GetResourceForRendering() : nullptr;
+        return (RenderData && RenderData->LODRenderData.Num() > 0) ? RenderData->LODRenderData[0].RenderSections.Num() : 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 FString FUR_AppliedCharacterPartEntry::GetDebugString() const
 {
-    return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), *GetPathNameSafe(SpawnedComponent));
+    return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), *GetPathNameSafe(SpawnedActor));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,12 +177,9 @@ FGameplayTagContainer FUR_CharacterPartList::CollectCombinedTags() const
 
     for (const FUR_AppliedCharacterPartEntry& Entry : Entries)
     {
-        if (Entry.SpawnedComponent != nullptr)
+        if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Entry.SpawnedActor))
         {
-            if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Entry.SpawnedComponent->GetChildActor()))
-            {
-                TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
-            }
+            TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
         }
     }
 
@@ -163,16 +194,14 @@ bool FUR_CharacterPartList::SpawnActorForEntry(FUR_AppliedCharacterPartEntry& En
     {
         if (Entry.Part.PartClass != nullptr)
         {
-            if (USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo())
+            USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo();
+            UUR_CharacterPartPoolSubsystem* PartPool = UWorld::GetSubsystem<UUR_CharacterPartPoolSubsystem>(OwnerComponent->GetWorld());
+            if (ComponentToAttachTo && PartPool)
             {
-                UChildActorComponent* PartComponent = NewObject<UChildActorComponent>(OwnerComponent->GetOwner());
-
-                PartComponent->SetupAttachment(ComponentToAttachTo, Entry.Part.SocketName);
-                PartComponent->SetChildActorClass(Entry.Part.PartClass);
-                PartComponent->RegisterComponent();
-
-                if (AActor* SpawnedActor = PartComponent->GetChildActor())
+                if (AActor* SpawnedActor = PartPool->AcquirePartActor(Entry.Part.PartClass, OwnerComponent->GetOwner()))
                 {
+                    SpawnedActor->AttachToComponent(ComponentToAttachTo, FAttachmentTransformRules::SnapToTargetIncludingScale, Entry.Part.SocketName);
+
                     switch (Entry.Part.CollisionMode)
                     {
                         case ECharacterCustomizationCollisionMode::UseCollisionFromCharacterPart:
@@ -191,15 +220,11 @@ bool FUR_CharacterPartList::SpawnActorForEntry(FUR_AppliedCharacterPartEntry& En
                         }
                     }
 
-                    // Set up a direct tick dependency to work around the child actor component not providing one
-                    if (USceneComponent* SpawnedRootComponent = SpawnedActor->GetRootComponent())
-                    {
-                        SpawnedRootComponent->AddTickPrerequisiteComponent(ComponentToAttachTo);
-                    }
-                }
+                    OwnerComponent->SetupPartActorMeshes(SpawnedActor, Entry.Part.SocketName);
 
-                Entry.SpawnedComponent = PartComponent;
-                bCreatedAnyActors = true;
+                    Entry.SpawnedActor = SpawnedActor;
+                    bCreatedAnyActors = true;
+                }
             }
         }
     }
@@ -211,10 +236,24 @@ bool FUR_CharacterPartList::DestroyActorForEntry(FUR_AppliedCharacterPartEntry&
 {
     bool bDestroyedAnyActors = false;
 
-    if (Entry.SpawnedComponent != nullptr)
+    if (Entry.SpawnedActor != nullptr)
     {
-        Entry.SpawnedComponent->DestroyComponent();
-        Entry.SpawnedComponent = nullptr;
+        // The merged mesh may be displayed by this part
+        if (OwnerComponent)
+        {
+            OwnerComponent->UnmergePartMeshes();
+        }
+
+        if (UUR_CharacterPartPoolSubsystem* PartPool = UWorld::GetSubsystem<UUR_CharacterPartPoolSubsystem>(Entry.SpawnedActor->GetWorld()))
+        {
+            PartPool->ReleasePartActor(Entry.SpawnedActor);
+        }
+        else
+        {
+            Entry.SpawnedActor->Destroy();
+        }
+
+        Entry.SpawnedActor = nullptr;
         bDestroyedAnyActors = true;
     }
 
@@ -280,12 +319,9 @@ TArray<AActor*> UUR_PawnComponent_CharacterParts::GetCharacterPartActors() const
 
     for (const FUR_AppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
     {
-        if (UChildActorComponent* PartComponent = Entry.SpawnedComponent)
+        if (AActor* SpawnedActor = Entry.SpawnedActor)
         {
-            if (AActor* SpawnedActor = PartComponent->GetChildActor())
-            {
-                Result.Add(SpawnedActor);
-            }
+            Result.Add(SpawnedActor);
         }
     }
 
@@ -358,6 +394,117 @@ void UUR_PawnComponent_CharacterParts::BroadcastChanged()
         }
     }
 
+    // Before observers apply their material changes (eg. team colors) to the part meshes
+    MergePartMeshes();
+
     // Let observers know, e.g., if they need to apply team coloring or similar
     OnCharacterPartsChanged.Broadcast(this);
 }
+
+void UUR_PawnComponent_CharacterParts::SetupPartActorMeshes(AActor* PartActor, FName SocketName) const
+{
+    // A part on a socket is already placed by its attachment, following the pose would apply the socket transform twice
+    if (SocketName != NAME_None)
+    {
+        return;
+    }
+
+    USkeletalMeshComponent* ParentMesh = GetParentMeshComponent();
+    const USkeleton* ParentSkeleton = URCharacterParts::GetSkeleton(ParentMesh);
+    if (ParentSkeleton == nullptr)
+    {
+        return;
+    }
+
+    TInlineComponentArray<USkeletalMeshComponent*> PartMeshes(PartActor);
+    for (USkeletalMeshComponent* PartMesh : PartMeshes)
+    {
+        if (URCharacterParts::GetSkeleton(PartMesh) == ParentSkeleton)
+        {
+            // Pose is copied from the body when it updates, nothing left to tick
+            PartMesh->SetLeaderPoseComponent(ParentMesh);
+            PartMesh->SetComponentTickEnabled(false);
+        }
+    }
+
+    PartActor->SetActorTickEnabled(false);
+}
+
+void UUR_PawnComponent_CharacterParts::MergePartMeshes()
+{
+    UnmergePartMeshes();
+
+    if (!OTConsoleVariables::bMergeCharacterPartMeshes || IsNetMode(NM_DedicatedServer))
+    {
+        return;
+    }
+
+    USkeletalMeshComponent* ParentMesh = GetParentMeshComponent();
+    USkeleton* ParentSkeleton = const_cast<USkeleton*>(URCharacterParts::GetSkeleton(ParentMesh));
+    UUR_CharacterPartPoolSubsystem* PartPool = UWorld::GetSubsystem<UUR_CharacterPartPoolSubsystem>(GetWorld());
+    if (ParentSkeleton == nullptr || PartPool == nullptr)
+    {
+        return;
+    }
+
+    // Visible part meshes following the body, with no material overrides of their own (those would be lost)
+    TArray<USkeletalMeshComponent*, TInlineAllocator<8>> Candidates;
+    TArray<USkeletalMesh*> Meshes;
+    int32 NumSectionsBefore = 0;
+    for (AActor* PartActor : GetCharacterPartActors())
+    {
+        TInlineComponentArray<USkeletalMeshComponent*> PartMeshes(PartActor);
+        for (USkeletalMeshComponent* PartMesh : PartMeshes)
+        {
+            const USkeletalMeshComponent* Archetype = Cast<USkeletalMeshComponent>(PartMesh->GetArchetype());
+            if (PartMesh->LeaderPoseComponent.Get() == ParentMesh && PartMesh->IsVisible()
+                && (Archetype == nullptr || Archetype->OverrideMaterials.Num() == 0))
+            {
+                Candidates.Add(PartMesh);
+                Meshes.Add(PartMesh->GetSkeletalMeshAsset());
+                NumSectionsBefore += URCharacterParts::GetNumSections(PartMesh->GetSkeletalMeshAsset());
+            }
+        }
+    }
+
+    USkeletalMesh* MergedMesh = PartPool->GetMergedMesh(Meshes, ParentSkeleton);
+    if (MergedMesh == nullptr)
+    {
+        return;
+    }
+
+    MergedHostComponent = Candidates[0];
+    MergedHostOriginalMesh = MergedHostComponent->GetSkeletalMeshAsset();
+    MergedHostComponent->EmptyOverrideMaterials();
+    MergedHostComponent->SetSkeletalMesh(MergedMesh, /*bReinitPose=*/ false);
+
+    for (int32 i = 1; i < Candidates.Num(); i++)
+    {
+        Candidates[i]->SetVisibility(false);
+        MergedHiddenComponents.Add(Candidates[i]);
+    }
+
+    PartPool->RecordMergedParts(Candidates.Num(), NumSectionsBefore, URCharacterParts::GetNumSections(MergedMesh));
+}
+
+void UUR_PawnComponent_CharacterParts::UnmergePartMeshes()
+{
+    if (MergedHostComponent)
+    {
+        // Observers may have put per-section materials on the merged mesh
+        MergedHostComponent->EmptyOverrideMaterials();
+        MergedHostComponent->SetSkeletalMesh(MergedHostOriginalMesh, /*bReinitPose=*/ false);
+    }
+
+    for (USkeletalMeshComponent* HiddenComponent : MergedHiddenComponents)
+    {
+        if (HiddenComponent)
+        {
+            HiddenComponent->SetVisibility(true);
+        }
+    }
+
+    MergedHostComponent = nullptr;
+    MergedHostOriginalMesh = nullptr;
+    MergedHiddenComponents.Reset();
+}
@@ -21,9 +21,9 @@ namespace EEndPlayReason
 }
 
 class AActor;
-class UChildActorComponent;
 class UObject;
 class USceneComponent;
+class USkeletalMesh;
 class USkeletalMeshComponent;
 class UUR_PawnComponent_CharacterParts;
 
@@ -62,9 +62,9 @@ private:
     UPROPERTY(NotReplicated)
     int32 PartHandle = INDEX_NONE;
 
-    // The spawned actor instance (client only)
+    // The spawned actor instance (client only), owned by UUR_CharacterPartPoolSubsystem
     UPROPERTY(NotReplicated)
-    TObjectPtr<UChildActorComponent> SpawnedComponent = nullptr;
+    TObjectPtr<AActor> SpawnedActor = nullptr;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,7 +131,13 @@ struct TStructOpsTypeTraits<FUR_CharacterPartList> : public TStructOpsTypeTraits
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-// A component that handles spawning cosmetic actors attached to the owner pawn on all clients
+/**
+ * A component that handles spawning cosmetic actors attached to the owner pawn on all clients.
+ *
+ * Part actors come from UUR_CharacterPartPoolSubsystem and go back to it when removed.
+ * Their skeletal meshes sharing the body's skeleton follow its pose (leader pose, no tick of their own), and
+ * when OT.Cosmetics.MergePartMeshes is set, those are merged into a single mesh displayed by the first of them.
+ */
 UCLASS(meta=(BlueprintSpawnableComponent))
 class UUR_PawnComponent_CharacterParts : public UPawnComponent
 {
@@ -175,6 +181,13 @@ public:
 
     void BroadcastChanged();
 
+    // Makes the part's skeletal meshes follow the body's pose instead of animating on their own.
+    // Only for parts attached at the root of the body, parts on a socket keep their own pose.
+    void SetupPartActorMeshes(AActor* PartActor, FName SocketName) const;
+
+    // Restores the part meshes hidden or replaced by MergePartMeshes
+    void UnmergePartMeshes();
+
 public:
     // Delegate that will be called when the list of spawned character parts has changed
     UPROPERTY(BlueprintAssignable, Category=Cosmetics, BlueprintCallable)
@@ -188,4 +201,17 @@ private:
     // Rules for how to pick a body style mesh for animation to play on, based on character part cosmetics tags
     UPROPERTY(EditAnywhere, Category=Cosmetics)
     FUR_AnimBodyStyleSelectionSet BodyMeshes;
+
+    void MergePartMeshes();
+
+    // Part mesh displaying the merged mesh, and the mesh it had before
+    UPROPERTY(Transient)
+    TObjectPtr<USkeletalMeshComponent> MergedHostComponent;
+
+    UPROPERTY(Transient)
+    TObjectPtr<USkeletalMesh> MergedHostOriginalMesh;
+
+    // Part meshes hidden because they are part of the merged mesh
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<USkeletalMeshComponent>> MergedHiddenComponents;
 };
@@ -58,6 +58,9 @@ void UUR_AbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 
     Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
 
+    // Tag-based results cached against the previous avatar are no longer valid
+    ++OwnedTagsGeneration;
+
     if (bHasNewPawnAvatar)
     {
         // Notify all abilities that a new pawn avatar has been set
@@ -525,6 +528,13 @@ void UUR_AbilitySystemComponent::HandleChangeAbilityCanBeCanceled(const FGamepla
     //@TODO: Apply any special logic like blocking input or movement
 }
 
+void UUR_AbilitySystemComponent::OnTagUpdated(const FGameplayTag& Tag, bool TagExists)
+{
+    Super::OnTagUpdated(Tag, TagExists);
+
+    ++OwnedTagsGeneration;
+}
+
 void UUR_AbilitySystemComponent::ClientNotifyAbilityFailed_Implementation(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureReason)
 {
     HandleAbilityFailed(Ability, FailureReason);
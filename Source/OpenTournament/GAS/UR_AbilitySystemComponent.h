@@ -78,6 +78,10 @@ public:
 
     UE_API void TryActivateAbilitiesOnSpawn();
 
+    // Bumped whenever a tag is added to or fully removed from the owned tags, or the avatar changes.
+    // Lets callers cache results derived from GetOwnedGameplayTags() until the tags actually change.
+    uint32 GetOwnedTagsGeneration() const { return OwnedTagsGeneration; }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 protected:
     UE_API virtual void AbilitySpecInputPressed(FGameplayAbilitySpec& Spec) override;
@@ -95,6 +99,8 @@ protected:
 
     UE_API void HandleAbilityFailed(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureReason);
 
+    UE_API virtual void OnTagUpdated(const FGameplayTag& Tag, bool TagExists) override;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 protected:
     // If set, this table is used to look up tag relationships for activate and cancel
@@ -113,6 +119,9 @@ protected:
     // Number of abilities running in each activation group.
     int32 ActivationGroupCounts[static_cast<uint8>(EGameAbilityActivationGroup::MAX)];
 
+    // See GetOwnedTagsGeneration
+    uint32 OwnedTagsGeneration = 0;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 };
 
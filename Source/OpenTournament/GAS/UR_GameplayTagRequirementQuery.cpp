@@ -0,0 +1,125 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_GameplayTagRequirementQuery.h"
+
+#include <AbilitySystemGlobals.h>
+#include "GameplayTagAssetInterface.h"
+
+#include "UR_AbilitySystemComponent.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace URGameplayTagRequirementQuery
+{
+    // Stale entries (destroyed actors) are pruned once the cache grows past this
+    static constexpr int32 MaxCachedResults = 64;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FUR_GameplayTagRequirementQuery::Compile(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    ExcludedTags = InExcludedTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    CachedResults.Reset();
+}
+
+bool FUR_GameplayTagRequirementQuery::Matches(const FGameplayTagContainer& TargetTags) const
+{
+    if (!RequiredTags.IsEmpty())
+    {
+        const bool bHasRequired = bRequiredTagsExact ? TargetTags.HasAnyExact(RequiredTags) : TargetTags.HasAny(RequiredTags);
+        if (!bHasRequired)
+        {
+            return false;
+        }
+    }
+
+    if (!ExcludedTags.IsEmpty())
+    {
+        const bool bHasExcluded = bExcludedTagsExact ? TargetTags.HasAnyExact(ExcludedTags) : TargetTags.HasAny(ExcludedTags);
+        if (bHasExcluded)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FUR_GameplayTagRequirementQuery::IsActorPermitted(const AActor* TargetActor) const
+{
+    if (TargetActor == nullptr)
+    {
+        return false;
+    }
+
+    if (IsEmpty())
+    {
+        return true;
+    }
+
+    if (const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor))
+    {
+        const UUR_AbilitySystemComponent* GameASC = Cast<UUR_AbilitySystemComponent>(ASC);
+        if (GameASC == nullptr)
+        {
+            // No tag generation to cache against, but the owned tags can still be read in place
+            return Matches(ASC->GetOwnedGameplayTags());
+        }
+
+        const uint32 TagsGeneration = GameASC->GetOwnedTagsGeneration();
+        if (const FCachedResult* Cached = CachedResults.Find(TargetActor))
+        {
+            if (Cached->AbilitySystem == GameASC && Cached->TagsGeneration == TagsGeneration)
+            {
+                return Cached->bPermitted;
+            }
+        }
+
+        const bool bPermitted = Matches(GameASC->GetOwnedGameplayTags());
+
+        if (CachedResults.Num() >= URGameplayTagRequirementQuery::MaxCachedResults)
+        {
+            PruneCache();
+        }
+
+        FCachedResult& Result = CachedResults.FindOrAdd(TargetActor);
+        Result.AbilitySystem = GameASC;
+        Result.TagsGeneration = TagsGeneration;
+        Result.bPermitted = bPermitted;
+
+        return bPermitted;
+    }
+
+    if (const IGameplayTagAssetInterface* TagActor = Cast<IGameplayTagAssetInterface>(TargetActor))
+    {
+        ScratchTags.Reset();
+        TagActor->GetOwnedGameplayTags(ScratchTags);
+        return Matches(ScratchTags);
+    }
+
+    return true;
+}
+
+void FUR_GameplayTagRequirementQuery::PruneCache() const
+{
+    for (auto It = CachedResults.CreateIterator(); It; ++It)
+    {
+        if (It->Key.ResolveObjectPtr() == nullptr || It->Value.AbilitySystem.ResolveObjectPtr() == nullptr)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    // Everything is still alive, start over rather than growing without bound
+    if (CachedResults.Num() >= URGameplayTagRequirementQuery::MaxCachedResults)
+    {
+        CachedResults.Reset();
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+class UAbilitySystemComponent;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Required / Excluded tag test used by map triggers (JumpPads, Teleporters, TriggerZones...).
+ *
+ * Compiled once from the trigger's RequiredTags / ExcludedTags settings when the trigger is set up.
+ * Actors with an ability system are tested against a reference to its owned tags (no copy), and the
+ * result is cached per actor until the ability system reports a tag change.
+ * Triggers change their tag settings at runtime through SetTagRequirements(), which calls Compile() again.
+ */
+struct OPENTOURNAMENT_API FUR_GameplayTagRequirementQuery
+{
+    void Compile(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
+    /** Test a set of tags against the requirements */
+    bool Matches(const FGameplayTagContainer& TargetTags) const;
+
+    /**
+     * Test an actor's owned tags against the requirements.
+     * Actors that expose no gameplay tags at all are permitted.
+     */
+    bool IsActorPermitted(const AActor* TargetActor) const;
+
+    /** True if every actor passes (no Required or Excluded tags) */
+    bool IsEmpty() const { return RequiredTags.IsEmpty() && ExcludedTags.IsEmpty(); }
+
+private:
+    struct FCachedResult
+    {
+        TObjectKey<UAbilitySystemComponent> AbilitySystem;
+        uint32 TagsGeneration = 0;
+        bool bPermitted = false;
+    };
+
+    void PruneCache() const;
+
+    FGameplayTagContainer RequiredTags;
+    FGameplayTagContainer ExcludedTags;
+    bool bRequiredTagsExact = false;
+    bool bExcludedTagsExact = true;
+
+    mutable TMap<TObjectKey<AActor>, FCachedResult> CachedResults;
+
+    // Reused for actors that only implement IGameplayTagAssetInterface, keeps its allocation between calls
+    mutable FGameplayTagContainer ScratchTags;
+};
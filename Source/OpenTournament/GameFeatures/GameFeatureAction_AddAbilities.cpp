@@ -5,7 +5,9 @@
 #include "GameFeatureAction_AddAbilities.h"
 
 #include "Components/GameFrameworkComponentManager.h"
+#include "Engine/AssetManager.h"
 #include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/World.h"
 
 #include "GameFeatures/GameFeatureAction_WorldActionBase.h"
@@ -20,9 +22,41 @@
 
 #define LOCTEXT_NAMESPACE "GameFeatures"
 
+//////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+	static float AbilityGrantBudgetMs = 1.0f;
+	static FAutoConsoleVariableRef CVarAbilityGrantBudgetMs
+	(
+		TEXT("OT.GameFeatures.AbilityGrantBudgetMs"),
+		AbilityGrantBudgetMs,
+		TEXT("Milliseconds per frame spent granting game feature abilities to actors. At least one actor is granted per frame. 0 grants immediately."),
+		ECVF_Default
+	);
+}
+
 //////////////////////////////////////////////////////////////////////
 // UGameFeatureAction_AddAbilities
 
+void UGameFeatureAction_AddAbilities::OnGameFeatureLoading()
+{
+	Super::OnGameFeatureLoading();
+
+	PreloadGrantedAssets();
+}
+
+void UGameFeatureAction_AddAbilities::OnGameFeatureUnloading()
+{
+	Super::OnGameFeatureUnloading();
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+		PreloadHandle.Reset();
+	}
+}
+
 void UGameFeatureAction_AddAbilities::OnGameFeatureActivating(FGameFeatureActivatingContext& Context)
 {
 	FPerContextData& ActiveData = ContextData.FindOrAdd(Context);
@@ -32,6 +66,10 @@ void UGameFeatureAction_AddAbilities::OnGameFeatureActivating(FGameFeatureActiva
 	{
 		Reset(ActiveData);
 	}
+
+	// Normally already streaming since the feature loaded
+	PreloadGrantedAssets();
+
 	Super::OnGameFeatureActivating(Context);
 }
 
@@ -142,6 +180,7 @@ void UGameFeatureAction_AddAbilities::Reset(FPerContextData& ActiveData)
 		RemoveActorAbilities(ExtensionIt->Key, ActiveData);
 	}
 
+	ActiveData.PendingGrants.Empty();
 	ActiveData.ComponentRequests.Empty();
 }
 
@@ -153,10 +192,17 @@ void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, FName
 		const FGameFeatureAbilitiesEntry& Entry = AbilitiesList[EntryIndex];
 		if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved) || (EventName == UGameFrameworkComponentManager::NAME_ReceiverRemoved))
 		{
+			ActiveData->PendingGrants.RemoveAll([Actor](const FPendingGrant& Grant) { return Grant.Actor == Actor; });
 			RemoveActorAbilities(Actor, *ActiveData);
 		}
-		else if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded) || (EventName == AUR_PlayerState::NAME_GameAbilityReady))
+		else if (EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded)
 		{
+			QueueActorAbilities(Actor, EntryIndex, *ActiveData);
+		}
+		else if (EventName == AUR_PlayerState::NAME_GameAbilityReady)
+		{
+			// The actor is ready to use its abilities, apply whatever is still queued for it now and in order
+			FlushPendingGrants(Actor, *ActiveData);
 			AddActorAbilities(Actor, Entry, *ActiveData);
 		}
 	}
@@ -220,7 +266,7 @@ void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGa
 		UUR_AbilitySystemComponent* UR_ASC = CastChecked<UUR_AbilitySystemComponent>(AbilitySystemComponent);
 		for (const TSoftObjectPtr<const UUR_AbilitySet>& SetPtr : AbilitiesEntry.GrantedAbilitySets)
 		{
-			if (const UUR_AbilitySet* Set = SetPtr.Get())
+			if (const UUR_AbilitySet* Set = SetPtr.LoadSynchronous())
 			{
 				Set->GiveToAbilitySystem(UR_ASC, &AddedExtensions.AbilitySetHandles.AddDefaulted_GetRef());
 			}
@@ -261,6 +307,140 @@ void UGameFeatureAction_AddAbilities::RemoveActorAbilities(AActor* Actor, FPerCo
 	}
 }
 
+void UGameFeatureAction_AddAbilities::PreloadGrantedAssets()
+{
+	if (PreloadHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		for (const FUR_AbilityGrant& Ability : Entry.GrantedAbilities)
+		{
+			if (!Ability.AbilityType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Ability.AbilityType.ToSoftObjectPath());
+			}
+		}
+
+		for (const FUR_AttributeSetGrant& Attributes : Entry.GrantedAttributes)
+		{
+			if (!Attributes.AttributeSetType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.AttributeSetType.ToSoftObjectPath());
+			}
+			if (!Attributes.InitializationData.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.InitializationData.ToSoftObjectPath());
+			}
+		}
+
+		for (const TSoftObjectPtr<const UUR_AbilitySet>& SetPtr : Entry.GrantedAbilitySets)
+		{
+			if (!SetPtr.IsNull())
+			{
+				AssetsToLoad.AddUnique(SetPtr.ToSoftObjectPath());
+			}
+		}
+	}
+
+	if (AssetsToLoad.Num() > 0)
+	{
+		PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+}
+
+bool UGameFeatureAction_AddAbilities::IsPreloadComplete() const
+{
+	return !PreloadHandle.IsValid() || PreloadHandle->HasLoadCompletedOrStalled() || PreloadHandle->WasCanceled();
+}
+
+void UGameFeatureAction_AddAbilities::QueueActorAbilities(AActor* Actor, int32 EntryIndex, FPerContextData& ActiveData)
+{
+	check(Actor);
+	if (!Actor->HasAuthority())
+	{
+		return;
+	}
+
+	if (OTConsoleVariables::AbilityGrantBudgetMs <= 0.f && IsPreloadComplete())
+	{
+		AddActorAbilities(Actor, AbilitiesList[EntryIndex], ActiveData);
+		return;
+	}
+
+	ActiveData.PendingGrants.Add({ Actor, EntryIndex });
+
+	if (!PendingGrantsTickerHandle.IsValid())
+	{
+		PendingGrantsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::ProcessPendingGrants));
+	}
+}
+
+void UGameFeatureAction_AddAbilities::FlushPendingGrants(AActor* Actor, FPerContextData& ActiveData)
+{
+	for (int32 GrantIndex = 0; GrantIndex < ActiveData.PendingGrants.Num();)
+	{
+		const FPendingGrant Grant = ActiveData.PendingGrants[GrantIndex];
+		if (Grant.Actor != Actor)
+		{
+			++GrantIndex;
+			continue;
+		}
+
+		ActiveData.PendingGrants.RemoveAt(GrantIndex, 1, EAllowShrinking::No);
+		if (AbilitiesList.IsValidIndex(Grant.EntryIndex))
+		{
+			AddActorAbilities(Actor, AbilitiesList[Grant.EntryIndex], ActiveData);
+		}
+	}
+}
+
+bool UGameFeatureAction_AddAbilities::ProcessPendingGrants(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_GameFeatureAction_AddAbilities_ProcessPendingGrants);
+
+	// Granting before the classes are in memory would load them synchronously, which is the hitch we are avoiding
+	if (!IsPreloadComplete())
+	{
+		return true;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + OTConsoleVariables::AbilityGrantBudgetMs / 1000.0;
+	bool bGrantedAny = false;
+	bool bHasPendingGrants = false;
+
+	for (TPair<FGameFeatureStateChangeContext, FPerContextData>& ContextPair : ContextData)
+	{
+		FPerContextData& ActiveData = ContextPair.Value;
+
+		while (ActiveData.PendingGrants.Num() > 0 && (!bGrantedAny || FPlatformTime::Seconds() < EndTime))
+		{
+			// Pop before granting, granting can send extension events that touch the queue
+			const FPendingGrant Grant = ActiveData.PendingGrants[0];
+			ActiveData.PendingGrants.RemoveAt(0, 1, EAllowShrinking::No);
+
+			AActor* Actor = Grant.Actor.Get();
+			if (Actor && AbilitiesList.IsValidIndex(Grant.EntryIndex))
+			{
+				AddActorAbilities(Actor, AbilitiesList[Grant.EntryIndex], ActiveData);
+				bGrantedAny = true;
+			}
+		}
+
+		bHasPendingGrants |= ActiveData.PendingGrants.Num() > 0;
+	}
+
+	if (!bHasPendingGrants)
+	{
+		PendingGrantsTickerHandle.Reset();
+	}
+
+	return bHasPendingGrants;
+}
+
 UActorComponent* UGameFeatureAction_AddAbilities::FindOrAddComponentForActor(UClass* ComponentType, AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, FPerContextData& ActiveData)
 {
 	UActorComponent* Component = Actor->FindComponentByClass(ComponentType);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "GameFeatureAction_WorldActionBase.h"
 #include "Abilities/GameplayAbility.h"
 #include "AbilitySystem/UR_AbilitySet.h"
@@ -17,6 +18,7 @@ class UInputAction;
 class UAttributeSet;
 class UDataTable;
 struct FComponentRequestHandle;
+struct FStreamableHandle;
 class UUR_AbilitySet;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +82,10 @@ struct FGameFeatureAbilitiesEntry
 
 /**
  * GameFeatureAction responsible for granting abilities (and attributes) to actors of a specified type.
+ *
+ * Granted classes and ability sets are streamed in when the feature loads. Actors that already exist when the
+ * feature activates are granted over several frames (OT.GameFeatures.AbilityGrantBudgetMs). Grants are applied
+ * in arrival order, and an actor that reports NAME_GameAbilityReady receives its pending grants immediately.
  */
 UCLASS(MinimalAPI, meta = (DisplayName = "Add Abilities"))
 class UGameFeatureAction_AddAbilities final : public UGameFeatureAction_WorldActionBase
@@ -88,6 +94,8 @@ class UGameFeatureAction_AddAbilities final : public UGameFeatureAction_WorldAct
 
 public:
 	//~ Begin UGameFeatureAction interface
+	virtual void OnGameFeatureLoading() override;
+	virtual void OnGameFeatureUnloading() override;
 	virtual void OnGameFeatureActivating(FGameFeatureActivatingContext& Context) override;
 	virtual void OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context) override;
 	//~ End UGameFeatureAction interface
@@ -110,14 +118,28 @@ private:
 		TArray<FUR_AbilitySet_GrantedHandles> AbilitySetHandles;
 	};
 
+	struct FPendingGrant
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 EntryIndex = INDEX_NONE;
+	};
+
 	struct FPerContextData
 	{
 		TMap<AActor*, FActorExtensions> ActiveExtensions;
 		TArray<TSharedPtr<FComponentRequestHandle>> ComponentRequests;
+
+		// Grants waiting for the preload or for frame budget, in the order they were requested
+		TArray<FPendingGrant> PendingGrants;
 	};
 
 	TMap<FGameFeatureStateChangeContext, FPerContextData> ContextData;
 
+	// Keeps every class and ability set referenced by AbilitiesList loaded while the feature is loaded
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	FTSTicker::FDelegateHandle PendingGrantsTickerHandle;
+
 	//~ Begin UGameFeatureAction_WorldActionBase interface
 	virtual void AddToWorld(const FWorldContext& WorldContext, const FGameFeatureStateChangeContext& ChangeContext) override;
 	//~ End UGameFeatureAction_WorldActionBase interface
@@ -127,6 +149,12 @@ private:
 	void AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, FPerContextData& ActiveData);
 	void RemoveActorAbilities(AActor* Actor, FPerContextData& ActiveData);
 
+	void PreloadGrantedAssets();
+	bool IsPreloadComplete() const;
+	void QueueActorAbilities(AActor* Actor, int32 EntryIndex, FPerContextData& ActiveData);
+	void FlushPendingGrants(AActor* Actor, FPerContextData& ActiveData);
+	bool ProcessPendingGrants(float DeltaTime);
+
 	template<class ComponentType>
 	ComponentType* FindOrAddComponentForActor(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, FPerContextData& ActiveData)
 	{
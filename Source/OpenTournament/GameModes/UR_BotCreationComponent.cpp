@@ -10,6 +10,9 @@
 
 #include "Development/UR_DeveloperSettings.h"
 #include "UR_GameMode.h"
+#include "UR_LogChannels.h"
+#include "AI/UR_BotController.h"
+#include "Player/UR_PlayerBotController.h"
 #include "GameModes/UR_ExperienceManagerComponent.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_BotCreationComponent)
@@ -51,6 +54,14 @@ void UUR_BotCreationComponent::ServerCreateBots()
 
     RemainingBotNames = RandomBotNames;
 
+    // Same seed and build, same bots: lets two bot matches be compared frame for frame
+    if (const AUR_GameMode* GameMode = GetGameMode<AUR_GameMode>())
+    {
+        MatchSeed = GameMode->GetMatchSeed();
+    }
+    BotCreationRandom.Initialize(MatchSeed);
+    NumBotsSpawned = 0;
+
     // Determine how many bots to spawn
     int32 EffectiveBotCount = NumBotsToCreate;
 
@@ -82,14 +93,14 @@ FString UUR_BotCreationComponent::CreateBotName(int32 PlayerIndex)
     FString Result;
     if (RemainingBotNames.Num() > 0)
     {
-        const int32 NameIndex = FMath::RandRange(0, RemainingBotNames.Num() - 1);
+        const int32 NameIndex = BotCreationRandom.RandRange(0, RemainingBotNames.Num() - 1);
         Result = RemainingBotNames[NameIndex];
         RemainingBotNames.RemoveAtSwap(NameIndex);
     }
     else
     {
         //@TODO: PlayerId is only being initialized for players right now
-        PlayerIndex = FMath::RandRange(260, 260 + 100);
+        PlayerIndex = BotCreationRandom.RandRange(260, 260 + 100);
         Result = FString::Printf(TEXT("Tinplate %d"), PlayerIndex);
     }
     return Result;
@@ -101,10 +112,23 @@ void UUR_BotCreationComponent::SpawnOneBot()
     SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
     SpawnInfo.OverrideLevel = GetComponentLevel();
     SpawnInfo.ObjectFlags |= RF_Transient;
+    SpawnInfo.bDeferConstruction = true;
     AAIController* NewController = GetWorld()->SpawnActor<AAIController>(BotControllerClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo);
 
     if (NewController != nullptr)
     {
+        // Seeded before construction finishes, the controller may already roll numbers while initializing
+        const int32 BotSeed = HashCombine(GetTypeHash(MatchSeed), GetTypeHash(NumBotsSpawned++));
+        if (AUR_PlayerBotController* PlayerBotController = Cast<AUR_PlayerBotController>(NewController))
+        {
+            PlayerBotController->SetRandomSeed(BotSeed);
+        }
+        else if (AUR_BotController* BotController = Cast<AUR_BotController>(NewController))
+        {
+            BotController->SetRandomSeed(BotSeed);
+        }
+        NewController->FinishSpawning(FTransform::Identity);
+
         AUR_GameMode* GameMode = GetGameMode<AUR_GameMode>();
         check(GameMode);
 
@@ -131,7 +155,7 @@ void UUR_BotCreationComponent::RemoveOneBot()
     {
         // Right now this removes a random bot as they're all the same; could prefer to remove one
         // that's high skill or low skill or etc... depending on why you are removing one
-        const int32 BotToRemoveIndex = FMath::RandRange(0, SpawnedBotList.Num() - 1);
+        const int32 BotToRemoveIndex = BotCreationRandom.RandRange(0, SpawnedBotList.Num() - 1);
 
         AAIController* BotToRemove = SpawnedBotList[BotToRemoveIndex];
         SpawnedBotList.RemoveAtSwap(BotToRemoveIndex);
@@ -39,6 +39,14 @@ protected:
 
     TArray<FString> RemainingBotNames;
 
+    // The game mode's match seed. Each bot gets its own stream derived from it.
+    int32 MatchSeed = 0;
+
+    // Bot names and removals
+    FRandomStream BotCreationRandom;
+
+    int32 NumBotsSpawned = 0;
+
 protected:
     UPROPERTY(Transient)
     TArray<TObjectPtr<AAIController>> SpawnedBotList;
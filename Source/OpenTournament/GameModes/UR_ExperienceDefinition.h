@@ -6,6 +6,8 @@
 
 #include <Engine/DataAsset.h>
 
+#include "Performance/UR_MemoryBudgetTypes.h"
+
 #include "UR_ExperienceDefinition.generated.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,4 +58,8 @@ public:
     // List of additional action sets to compose into this experience
     UPROPERTY(EditDefaultsOnly, Category=Gameplay)
     TArray<TObjectPtr<UUR_ExperienceActionSet>> ActionSets;
+
+    // Memory a match of this experience should stay within, checked by UUR_MemoryBudgetSubsystem
+    UPROPERTY(EditDefaultsOnly, Category=Performance)
+    FUR_MemoryBudget MemoryBudget;
 };
@@ -5,12 +5,255 @@
 #include "UR_ExperienceManager.h"
 #include "GameModes/UR_ExperienceManager.h"
 #include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFeaturesSubsystem.h"
+#include "GameFeaturesSubsystemSettings.h"
 #include "Subsystems/SubsystemCollection.h"
 
+#include "UR_ExperienceActionSet.h"
+#include "UR_ExperienceDefinition.h"
+#include "UR_LogChannels.h"
+#include "System/UR_AssetManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_ExperienceManager)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+void UUR_ExperienceManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &ThisClass::OnPreLoadMap);
+	SeamlessTravelStartHandle = FWorldDelegates::OnSeamlessTravelStart.AddUObject(this, &ThisClass::OnSeamlessTravelStart);
+}
+
+void UUR_ExperienceManager::Deinitialize()
+{
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FWorldDelegates::OnSeamlessTravelStart.Remove(SeamlessTravelStartHandle);
+
+	PrefetchHandle.Reset();
+	PrefetchActionSetsHandle.Reset();
+
+	Super::Deinitialize();
+}
+
+TArray<FName> UUR_ExperienceManager::GetExperienceBundlesToLoad(ENetMode NetMode)
+{
+	TArray<FName> BundlesToLoad;
+	BundlesToLoad.Add(FGameBundles::Equipped);
+
+	// @TODO: Centralize this client/server stuff into the UR_AssetManager
+	const bool bLoadClient = GIsEditor || (NetMode != NM_DedicatedServer);
+	const bool bLoadServer = GIsEditor || (NetMode != NM_Client);
+	if (bLoadClient)
+	{
+		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateClient);
+	}
+	if (bLoadServer)
+	{
+		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
+	}
+
+	return BundlesToLoad;
+}
+
+void UUR_ExperienceManager::PrefetchExperience(FPrimaryAssetId ExperienceId, ENetMode NetMode)
+{
+	if (!ExperienceId.IsValid() || ExperienceId == PrefetchedExperienceId)
+	{
+		return;
+	}
+
+	UE_LOG(LogGameExperience, Log, TEXT("EXPERIENCE: Prefetching %s"), *ExperienceId.ToString());
+
+	// Release the previous prefetch. Its plugins stay loaded until this one knows which of them it needs too.
+	if (PrefetchHandle.IsValid())
+	{
+		PrefetchHandle->CancelHandle();
+	}
+	if (PrefetchActionSetsHandle.IsValid())
+	{
+		PrefetchActionSetsHandle->CancelHandle();
+	}
+	PrefetchActionSetsHandle.Reset();
+	for (const FString& PluginURL : PrefetchedPluginURLs)
+	{
+		ReplacedPrefetchPluginURLs.AddUnique(PluginURL);
+	}
+	PrefetchedPluginURLs.Reset();
+
+	PrefetchedExperienceId = ExperienceId;
+	PrefetchedBundles = GetExperienceBundlesToLoad(NetMode);
+
+	// Low priority, this streams in while the current match is still being played
+	UUR_AssetManager& AssetManager = UUR_AssetManager::Get();
+	PrefetchHandle = AssetManager.LoadPrimaryAsset(ExperienceId, PrefetchedBundles, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+
+	if (!PrefetchHandle.IsValid() || PrefetchHandle->HasLoadCompleted())
+	{
+		OnPrefetchedExperienceLoaded();
+	}
+	else
+	{
+		PrefetchHandle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &ThisClass::OnPrefetchedExperienceLoaded));
+	}
+}
+
+void UUR_ExperienceManager::OnPrefetchedExperienceLoaded()
+{
+	UUR_AssetManager& AssetManager = UUR_AssetManager::Get();
+
+	const UClass* ExperienceClass = Cast<UClass>(AssetManager.GetPrimaryAssetObject(PrefetchedExperienceId));
+	if (ExperienceClass == nullptr || !ExperienceClass->IsChildOf(UUR_ExperienceDefinition::StaticClass()))
+	{
+		UE_LOG(LogGameExperience, Warning, TEXT("EXPERIENCE: Prefetch of %s did not produce an experience definition"), *PrefetchedExperienceId.ToString());
+		ReleaseReplacedPrefetchPlugins();
+		return;
+	}
+
+	const UUR_ExperienceDefinition* Experience = GetDefault<UUR_ExperienceDefinition>(ExperienceClass);
+
+	TArray<FPrimaryAssetId> ActionSetIds;
+	auto CollectGameFeaturePluginURLs = [this](const TArray<FString>& FeaturePluginList)
+	{
+		for (const FString& PluginName : FeaturePluginList)
+		{
+			FString PluginURL;
+			if (UGameFeaturesSubsystem::Get().GetPluginURLByName(PluginName, /*out*/ PluginURL))
+			{
+				PrefetchedPluginURLs.AddUnique(PluginURL);
+			}
+		}
+	};
+
+	CollectGameFeaturePluginURLs(Experience->GameFeaturesToEnable);
+	for (const TObjectPtr<UUR_ExperienceActionSet>& ActionSet : Experience->ActionSets)
+	{
+		if (ActionSet != nullptr)
+		{
+			ActionSetIds.Add(ActionSet->GetPrimaryAssetId());
+			CollectGameFeaturePluginURLs(ActionSet->GameFeaturesToEnable);
+		}
+	}
+
+	if (ActionSetIds.Num() > 0)
+	{
+		PrefetchActionSetsHandle = AssetManager.LoadPrimaryAssets(ActionSetIds, PrefetchedBundles, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+	}
+
+	ReleaseReplacedPrefetchPlugins();
+
+	// Load (but do not activate) the plugins, activation happens once the experience is set in the next world
+	for (const FString& PluginURL : PrefetchedPluginURLs)
+	{
+		UGameFeaturesSubsystem::Get().LoadGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete());
+	}
+}
+
+void UUR_ExperienceManager::ReleaseReplacedPrefetchPlugins()
+{
+	for (const FString& PluginURL : ReplacedPrefetchPluginURLs)
+	{
+		// Active ones belong to the current experience, which deactivates them itself once they are no longer prefetched
+		if (!PrefetchedPluginURLs.Contains(PluginURL) && !UGameFeaturesSubsystem::Get().IsGameFeaturePluginActive(PluginURL, /*bCheckForActivating=*/ true))
+		{
+			UGameFeaturesSubsystem::Get().UnloadGameFeaturePlugin(PluginURL);
+		}
+	}
+	ReplacedPrefetchPluginURLs.Reset();
+}
+
+bool UUR_ExperienceManager::ShouldKeepPluginActive(const FString& PluginURL)
+{
+	const UUR_ExperienceManager* ExperienceManagerSubsystem = GEngine->GetEngineSubsystem<UUR_ExperienceManager>();
+	return ExperienceManagerSubsystem && ExperienceManagerSubsystem->PrefetchedPluginURLs.Contains(PluginURL);
+}
+
+void UUR_ExperienceManager::NotifyExperienceLoaded(const UUR_ExperienceDefinition* Experience, ENetMode NetMode, const TArray<FString>& ActivePluginURLs)
+{
+	UUR_ExperienceManager* ExperienceManagerSubsystem = GEngine->GetEngineSubsystem<UUR_ExperienceManager>();
+	if (ExperienceManagerSubsystem == nullptr || Experience == nullptr)
+	{
+		return;
+	}
+
+	const FPrimaryAssetId ExperienceId = Experience->GetPrimaryAssetId();
+	const bool bWasPrefetched = (ExperienceId == ExperienceManagerSubsystem->PrefetchedExperienceId);
+
+	if (ExperienceManagerSubsystem->TravelStartTime > 0.0)
+	{
+		ExperienceManagerSubsystem->LastTravelToPlayableSeconds = FPlatformTime::Seconds() - ExperienceManagerSubsystem->TravelStartTime;
+		ExperienceManagerSubsystem->TravelStartTime = 0.0;
+
+		UE_LOG(LogGameExperience, Display, TEXT("EXPERIENCE: %s playable %.2f seconds after travel to %s (NetMode: %d, Prefetched: %s)"),
+			*ExperienceId.ToString(),
+			ExperienceManagerSubsystem->LastTravelToPlayableSeconds,
+			*ExperienceManagerSubsystem->TravelMapName,
+			static_cast<int32>(NetMode),
+			bWasPrefetched ? TEXT("Yes") : TEXT("No"));
+	}
+
+	// Plugins of prefetches replaced before they were done loading
+	TArray<FString> PluginURLsToRelease = ExperienceManagerSubsystem->ReplacedPrefetchPluginURLs;
+
+	// A prefetch for another experience kept its plugins loaded, and active if the previous experience used them
+	if (!bWasPrefetched && ExperienceManagerSubsystem->PrefetchedExperienceId.IsValid())
+	{
+		UE_LOG(LogGameExperience, Log, TEXT("EXPERIENCE: Releasing prefetch of %s, %s was loaded instead"),
+			*ExperienceManagerSubsystem->PrefetchedExperienceId.ToString(), *ExperienceId.ToString());
+
+		if (ExperienceManagerSubsystem->PrefetchHandle.IsValid())
+		{
+			ExperienceManagerSubsystem->PrefetchHandle->CancelHandle();
+		}
+		if (ExperienceManagerSubsystem->PrefetchActionSetsHandle.IsValid())
+		{
+			ExperienceManagerSubsystem->PrefetchActionSetsHandle->CancelHandle();
+		}
+
+		for (const FString& PluginURL : ExperienceManagerSubsystem->PrefetchedPluginURLs)
+		{
+			PluginURLsToRelease.AddUnique(PluginURL);
+		}
+	}
+
+	for (const FString& PluginURL : PluginURLsToRelease)
+	{
+		bool bInUse = ActivePluginURLs.Contains(PluginURL);
+#if WITH_EDITOR
+		// Other PIE worlds may have activated it as well
+		bInUse |= ExperienceManagerSubsystem->GameFeaturePluginRequestCountMap.Contains(PluginURL);
+#endif
+		if (!bInUse)
+		{
+			UGameFeaturesSubsystem::Get().UnloadGameFeaturePlugin(PluginURL);
+		}
+	}
+
+	// The active experience now holds its own bundle state and plugin activations
+	ExperienceManagerSubsystem->PrefetchedExperienceId = FPrimaryAssetId();
+	ExperienceManagerSubsystem->PrefetchHandle.Reset();
+	ExperienceManagerSubsystem->PrefetchActionSetsHandle.Reset();
+	ExperienceManagerSubsystem->PrefetchedPluginURLs.Reset();
+	ExperienceManagerSubsystem->ReplacedPrefetchPluginURLs.Reset();
+}
+
+void UUR_ExperienceManager::OnPreLoadMap(const FString& MapName)
+{
+	TravelStartTime = FPlatformTime::Seconds();
+	TravelMapName = MapName;
+}
+
+void UUR_ExperienceManager::OnSeamlessTravelStart(UWorld* World, const FString& LevelName)
+{
+	TravelStartTime = FPlatformTime::Seconds();
+	TravelMapName = LevelName;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if WITH_EDITOR
 
 void UUR_ExperienceManager::OnPlayInEditorBegun()
@@ -4,11 +4,19 @@
 
 #pragma once
 
+#include "Engine/EngineBaseTypes.h"
 #include "Subsystems/EngineSubsystem.h"
+#include "UObject/PrimaryAssetId.h"
 #include "UR_ExperienceManager.generated.h"
 
+class UUR_ExperienceDefinition;
+struct FStreamableHandle;
+
 /**
  * Manager for experiences - primarily for arbitration between multiple PIE sessions
+ *
+ * Also keeps a prefetched experience warm across map travel, so the next match in a rotation
+ * does not have to stream its bundles or load its game feature plugins from scratch.
  */
 UCLASS(MinimalAPI)
 class UUR_ExperienceManager : public UEngineSubsystem
@@ -16,6 +24,11 @@ class UUR_ExperienceManager : public UEngineSubsystem
 	GENERATED_BODY()
 
 public:
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
 #if WITH_EDITOR
 	OPENTOURNAMENT_API void OnPlayInEditorBegun();
 
@@ -26,8 +39,53 @@ public:
 	static bool RequestToDeactivatePlugin(const FString PluginURL) { return true; }
 #endif
 
+	// Bundles an experience needs for the given net mode
+	static TArray<FName> GetExperienceBundlesToLoad(ENetMode NetMode);
+
+	// Starts streaming the experience, its action sets and game feature plugins without activating anything.
+	// Replaces any previous prefetch, whose plugins are unloaded unless the new one or the current experience uses them.
+	// The loaded data is kept until the experience is activated or another one is prefetched.
+	OPENTOURNAMENT_API void PrefetchExperience(FPrimaryAssetId ExperienceId, ENetMode NetMode);
+
+	// Returns true if the plugin is needed by the prefetched experience and should stay active across travel
+	static bool ShouldKeepPluginActive(const FString& PluginURL);
+
+	// Called once an experience is fully loaded with the game feature plugins it activated, reports travel-to-playable time
+	// and releases the prefetch. Plugins prefetched for another experience are unloaded unless the loaded one uses them.
+	static void NotifyExperienceLoaded(const UUR_ExperienceDefinition* Experience, ENetMode NetMode, const TArray<FString>& ActivePluginURLs);
+
+	// Seconds between the last map travel starting and its experience becoming playable, negative if not measured yet
+	double GetLastTravelToPlayableSeconds() const { return LastTravelToPlayableSeconds; }
+
 private:
+	void OnPreLoadMap(const FString& MapName);
+	void OnSeamlessTravelStart(UWorld* World, const FString& LevelName);
+	void OnPrefetchedExperienceLoaded();
+
+	// Unloads the plugins of replaced prefetches that are neither prefetched again nor active
+	void ReleaseReplacedPrefetchPlugins();
+
 	// The map of requests to active count for a given game feature plugin
 	// (to allow first in, last out activation management during PIE)
 	TMap<FString, int32> GameFeaturePluginRequestCountMap;
+
+	FPrimaryAssetId PrefetchedExperienceId;
+	TArray<FName> PrefetchedBundles;
+
+	// Keeps the prefetched experience and action set bundles in memory across travel
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+	TSharedPtr<FStreamableHandle> PrefetchActionSetsHandle;
+
+	// Game feature plugins required by the prefetched experience
+	TArray<FString> PrefetchedPluginURLs;
+
+	// Plugins of replaced prefetches, released once the new prefetch knows which plugins it needs
+	TArray<FString> ReplacedPrefetchPluginURLs;
+
+	double TravelStartTime = 0.0;
+	FString TravelMapName;
+	double LastTravelToPlayableSeconds = -1.0;
+
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle SeamlessTravelStartHandle;
 };
@@ -80,7 +80,13 @@ void UUR_ExperienceManagerComponent::SetCurrentExperience(FPrimaryAssetId Experi
 
         if (AssetPath.IsValid())
         {
-            const TSubclassOf<UUR_ExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.TryLoad());
+            // A prefetched experience is already in memory, only fall back to a blocking load when it is not
+            TSubclassOf<UUR_ExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.ResolveObject());
+            if (AssetClass == nullptr)
+            {
+                UE_LOG(LogGameExperienceManagerComponent, Log, TEXT("Experience %s was not prefetched, loading synchronously"), *ExperienceId.ToString());
+                AssetClass = Cast<UClass>(AssetPath.TryLoad());
+            }
             check(AssetClass);
             const UUR_ExperienceDefinition* Experience = GetDefault<UUR_ExperienceDefinition>(AssetClass);
 
@@ -180,21 +186,7 @@ void UUR_ExperienceManagerComponent::StartExperienceLoad()
 
     // Load assets associated with the experience
 
-    TArray<FName> BundlesToLoad;
-    BundlesToLoad.Add(FGameBundles::Equipped);
-
-    // @TODO: Centralize this client/server stuff into the UR_AssetManager
-    const ENetMode OwnerNetMode = GetOwner()->GetNetMode();
-    const bool bLoadClient = GIsEditor || (OwnerNetMode != NM_DedicatedServer);
-    const bool bLoadServer = GIsEditor || (OwnerNetMode != NM_Client);
-    if (bLoadClient)
-    {
-        BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateClient);
-    }
-    if (bLoadServer)
-    {
-        BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
-    }
+    const TArray<FName> BundlesToLoad = UUR_ExperienceManager::GetExperienceBundlesToLoad(GetOwner()->GetNetMode());
 
     TSharedPtr<FStreamableHandle> BundleLoadHandle = nullptr;
     if (BundleAssetList.Num() > 0)
@@ -388,6 +380,8 @@ void UUR_ExperienceManagerComponent::OnExperienceFullLoadCompleted()
     OnExperienceLoaded_LowPriority.Broadcast(CurrentExperience);
     OnExperienceLoaded_LowPriority.Clear();
 
+    UUR_ExperienceManager::NotifyExperienceLoaded(CurrentExperience, GetOwner()->GetNetMode(), GameFeaturePluginURLs);
+
 	// Apply any necessary scalability settings
 #if !UE_SERVER
     UUR_SettingsLocal::Get()->OnExperienceLoaded();
@@ -420,7 +414,8 @@ void UUR_ExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
     //@TODO: This should be handled FILO as well
     for (const FString& PluginURL : GameFeaturePluginURLs)
     {
-        if (UUR_ExperienceManager::RequestToDeactivatePlugin(PluginURL))
+        // Plugins the next (prefetched) experience also needs stay active across travel
+        if (UUR_ExperienceManager::RequestToDeactivatePlugin(PluginURL) && !UUR_ExperienceManager::ShouldKeepPluginActive(PluginURL))
         {
             UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
         }
@@ -4,7 +4,6 @@
 
 #include "UR_GameMode.h"
 
-#include <EngineUtils.h>    // for TActorIterator<>
 #include <TimerManager.h>
 #include <Engine/DamageEvents.h>
 #include <GameFramework/Controller.h>
@@ -17,7 +16,6 @@
 #include "UR_InventoryComponent.h"
 #include "UR_PlayerController.h"
 #include "UR_PlayerState.h"
-#include "UR_Projectile.h"
 #include "UR_TeamInfo.h"
 #include "UR_Weapon.h"
 
@@ -35,6 +33,8 @@
 #include "UR_Widget_ScoreboardBase.h"
 #include "UR_WorldSettings.h"
 #include "AI/UR_BotController.h"
+#include "Replays/UR_ReplaySubsystem.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_GameMode)
 
@@ -44,7 +44,10 @@
 
 AUR_GameMode::AUR_GameMode()
     : BotFill(0)
+    , MatchSeed(0)
+    , NumBotsAdded(0)
     , DesiredTeamSize(0)
+    , bRecordReplay(false)
 {
     GameStateClass = AUR_GameState::StaticClass();
     GameSessionClass = AUR_GameSession::StaticClass();
@@ -97,6 +100,8 @@ void AUR_GameMode::InitGame(const FString& MapName, const FString& OptionsMeh, F
 
     MaxPlayers = UGameplayStatics::GetIntOption(Options, TEXT("MaxPlayers"), MaxPlayers);
     BotFill = UGameplayStatics::GetIntOption(Options, TEXT("BotFill"), BotFill);
+    MatchSeed = UGameplayStatics::GetIntOption(Options, TEXT("BotSeed"), FMath::Rand());
+    UE_LOG(LogGame, Log, TEXT("Match seed: %d (use ?BotSeed=%d to reproduce)"), MatchSeed, MatchSeed);
     NumTeams = UGameplayStatics::GetIntOption(Options, TEXT("NumTeams"), NumTeams); // @! TODO TeamGameComponent
 
     TeamsFillMode = UGameplayStatics::ParseOption(Options, TEXT("TeamsFillMode"));
@@ -104,6 +109,8 @@ void AUR_GameMode::InitGame(const FString& MapName, const FString& OptionsMeh, F
     TeamDamageDirect = UUR_FunctionLibrary::GetFloatOption(Options, TEXT("TeamDamageDirect"), TeamDamageDirect);
     TeamDamageRetaliate = UUR_FunctionLibrary::GetFloatOption(Options, TEXT("TeamDamageRetaliate"), TeamDamageRetaliate);
 
+    bRecordReplay = UGameplayStatics::HasOption(Options, TEXT("RecordReplay"));
+
     if (NumTeams > 0)
     {
         DesiredTeamSize = FMath::CeilToInt(static_cast<float>(MaxPlayers) / static_cast<float>(NumTeams));
@@ -529,8 +536,16 @@ void AUR_GameMode::CheckBots()
 
 void AUR_GameMode::AddBot()
 {
-    if (auto BotController = GetWorld()->SpawnActor<AController>(BotControllerClass))
+    FActorSpawnParameters SpawnInfo;
+    SpawnInfo.bDeferConstruction = true;
+    if (auto BotController = GetWorld()->SpawnActor<AUR_BotController>(BotControllerClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo))
     {
+        // Seeded before construction finishes, like UUR_BotCreationComponent does, so the player name uses it too.
+        // Salted so these bots do not share their streams with the ones the bot creation component spawns.
+        const int32 Seed = HashCombine(HashCombine(GetTypeHash(MatchSeed), GetTypeHash(NumBotsAdded++)), GetTypeHash(TEXT("BotFill")));
+        BotController->SetRandomSeed(Seed);
+        BotController->FinishSpawning(FTransform::Identity);
+
         GenericPlayerInitialization(BotController);
         OnPostLogin(BotController);
         RestartPlayer(BotController);
@@ -895,12 +910,14 @@ void AUR_GameMode::HandleMatchHasEnded()
 
     // Freeze the game
     //TODO: this is probably the wrong way to do it
-    for (TActorIterator<AActor> ActorIt(GetWorld()); ActorIt; ++ActorIt)
+    if (const UUR_ActorRegistrySubsystem* ActorRegistry = UWorld::GetSubsystem<UUR_ActorRegistrySubsystem>(GetWorld()))
     {
-        AActor* Actor = *ActorIt;
-        if (Cast<APawn>(Actor) || Cast<AUR_Projectile>(Actor))
+        for (const EUR_ActorRegistryCategory Category : { EUR_ActorRegistryCategory::Pawn, EUR_ActorRegistryCategory::Projectile })
         {
-            Actor->CustomTimeDilation = 0.01f;
+            for (AActor* Actor : ActorRegistry->GetActors(Category))
+            {
+                Actor->CustomTimeDilation = 0.01f;
+            }
         }
     }
 
@@ -986,6 +1003,16 @@ void AUR_GameMode::OnExperienceLoaded(const UUR_ExperienceDefinition* CurrentExp
             }
         }
     }
+
+    // Start recording once the experience is loaded, so the replay starts with the match rules and actors in place.
+    // The recording is finalized by the engine when the world is torn down (map change or server shutdown).
+    if (bRecordReplay || (GetNetMode() == NM_DedicatedServer && UUR_ReplaySubsystem::ShouldRecordDedicatedServerMatches()))
+    {
+        if (UUR_ReplaySubsystem* ReplaySubsystem = UGameInstance::GetSubsystem<UUR_ReplaySubsystem>(GetGameInstance()))
+        {
+            ReplaySubsystem->RecordMatch();
+        }
+    }
 }
 
 bool AUR_GameMode::IsExperienceLoaded() const
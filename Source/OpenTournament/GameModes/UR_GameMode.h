@@ -88,6 +88,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "OT|Pawn")
     const UUR_PawnData* GetPawnDataForController(const AController* InController) const;
 
+    // Seed of every random stream of the match (bots, player starts), picked once in InitGame
+    int32 GetMatchSeed() const { return MatchSeed; }
+
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Classes
@@ -129,6 +132,12 @@ public:
     UPROPERTY(Config, BlueprintReadWrite, EditDefaultsOnly, Category = "Parameters|Bots", meta = (DeprecatedProperty))
     int32 BotFill;
 
+    // From the BotSeed URL option, or random. Each bot added by BotFill gets its own stream derived from it.
+    int32 MatchSeed;
+
+    // Bots added by BotFill so far, the index their seed is derived from
+    int32 NumBotsAdded;
+
     UPROPERTY(Config, BlueprintReadWrite, EditDefaultsOnly, Category = "Parameters|TeamGame", meta = (DeprecatedProperty))
     int32 NumTeams;
 
@@ -147,6 +156,10 @@ public:
     UPROPERTY(BlueprintReadOnly, meta = (DeprecatedProperty))
     int32 DesiredTeamSize;
 
+    /** Record a replay of the match, set by the ?RecordReplay option. */
+    UPROPERTY(BlueprintReadOnly, Category = "Parameters")
+    bool bRecordReplay;
+
     UFUNCTION(BlueprintCallable)
     void BroadcastSystemMessage(const FString& Msg);
 
@@ -9,6 +9,7 @@
 #include <Misc/CommandLine.h>
 
 #include "UR_AssetManager.h"
+#include "UR_ChatComponent.h"
 #include "Development/UR_DeveloperSettings.h"
 #include "UR_ExperienceDefinition.h"
 #include "UR_ExperienceManagerComponent.h"
@@ -30,6 +31,7 @@ void AUR_GameModeBase::RegisterChatComponent(UUR_ChatComponent* InComponent)
     if (InComponent)
     {
         ChatComponents.AddUnique(InComponent);
+        InvalidateChatRecipients();
     }
 }
 
@@ -39,6 +41,51 @@ void AUR_GameModeBase::UnregisterChatComponent(UUR_ChatComponent* InComponent)
     {
         ChatComponents.Remove(InComponent);
     }
+    InvalidateChatRecipients();
+}
+
+const TArray<TWeakObjectPtr<UUR_ChatComponent>>& AUR_GameModeBase::GetChatRecipients(UUR_ChatComponent* Sender, int32 TeamIndex)
+{
+    const double Now = GetWorld()->GetRealTimeSeconds();
+    if (Now - ChatRecipientsBuildTime > ChatRecipientsMaxAge)
+    {
+        InvalidateChatRecipients();
+    }
+
+    // Per sender, ShouldReceive() overrides may depend on it (eg. mute lists)
+    const TPair<TObjectKey<UUR_ChatComponent>, int32> Key(Sender, TeamIndex);
+    if (const TArray<TWeakObjectPtr<UUR_ChatComponent>>* Recipients = ChatRecipientsBySenderAndChannel.Find(Key))
+    {
+        return *Recipients;
+    }
+
+    if (ChatRecipientsBySenderAndChannel.Num() == 0)
+    {
+        ChatRecipientsBuildTime = Now;
+    }
+
+    TArray<TWeakObjectPtr<UUR_ChatComponent>>& Recipients = ChatRecipientsBySenderAndChannel.Add(Key);
+    for (UUR_ChatComponent* Recipient : ChatComponents)
+    {
+        if (Recipient && Recipient->ShouldReceive(Sender, TeamIndex))
+        {
+            Recipients.Add(Recipient);
+        }
+    }
+    return Recipients;
+}
+
+void AUR_GameModeBase::InvalidateChatRecipients()
+{
+    ChatRecipientsBySenderAndChannel.Reset();
+}
+
+void AUR_GameModeBase::GenericPlayerInitialization(AController* C)
+{
+    Super::GenericPlayerInitialization(C);
+
+    // Spectator status is only known once the player is initialized, after its chat component registered
+    InvalidateChatRecipients();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
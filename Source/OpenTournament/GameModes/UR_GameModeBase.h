@@ -38,6 +38,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Chat")
     virtual void UnregisterChatComponent(class UUR_ChatComponent* InComponent);
 
+    /**
+    * Chat components that should receive messages from Sender on the given channel.
+    * Built once per sender and channel with ShouldReceive() and reused until invalidated or older than ChatRecipientsMaxAge.
+    */
+    const TArray<TWeakObjectPtr<class UUR_ChatComponent>>& GetChatRecipients(class UUR_ChatComponent* Sender, int32 TeamIndex);
+
+    /**
+    * Forces the chat recipient sets to be rebuilt on next message.
+    * Chat components call it when their owner changes team, player initialization when a player joins as spectator.
+    */
+    UFUNCTION(BlueprintCallable, Category = "Chat")
+    void InvalidateChatRecipients();
+
+    // Catches state changes that do not explicitly invalidate the recipient sets (eg. a Blueprint mute list)
+    UPROPERTY(EditDefaultsOnly, Category = "Chat")
+    float ChatRecipientsMaxAge = 2.f;
+
+    virtual void GenericPlayerInitialization(AController* C) override;
+
+protected:
+    TMap<TPair<TObjectKey<class UUR_ChatComponent>, int32>, TArray<TWeakObjectPtr<class UUR_ChatComponent>>> ChatRecipientsBySenderAndChannel;
+    double ChatRecipientsBuildTime = 0.0;
+
+public:
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Experience stuff
 
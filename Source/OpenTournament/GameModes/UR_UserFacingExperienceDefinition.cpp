@@ -25,7 +25,10 @@ UCommonSession_HostSessionRequest* UUR_UserFacingExperienceDefinition::CreateHos
 	Result->ExtraArgs.Add(TEXT("Experience"), ExperienceName);
 	Result->MaxPlayerCount = MaxPlayerCount;
 
-    // @! TODO : Add Replays to string
+	if (bRecordReplay)
+	{
+		Result->ExtraArgs.Add(TEXT("RecordReplay"), FString());
+	}
 
 	return Result;
 }
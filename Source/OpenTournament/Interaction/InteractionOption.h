@@ -66,6 +66,7 @@ public:
     //--------------------------------------------------------------
 
 public:
+    // Texts compare by content: an option rebuilt each scan with the same text is unchanged, an edited text is a change
     FORCEINLINE bool operator==(const FInteractionOption& Other) const
     {
         return InteractableTarget == Other.InteractableTarget &&
@@ -73,8 +74,8 @@ public:
             TargetAbilitySystem == Other.TargetAbilitySystem &&
             TargetInteractionAbilityHandle == Other.TargetInteractionAbilityHandle &&
             InteractionWidgetClass == Other.InteractionWidgetClass &&
-            Text.IdenticalTo(Other.Text) &&
-            SubText.IdenticalTo(Other.SubText);
+            Text.EqualTo(Other.Text) &&
+            SubText.EqualTo(Other.SubText);
     }
 
     FORCEINLINE bool operator!=(const FInteractionOption& Other) const
@@ -5,16 +5,10 @@
 #include "AbilityTask_GrantNearbyInteraction.h"
 
 #include "AbilitySystemComponent.h"
-#include "TimerManager.h"
-#include "Engine/OverlapResult.h"
 #include "Engine/World.h"
-#include "GameFramework/Controller.h"
 
-#include "Interaction/IInteractableTarget.h"
 #include "Interaction/InteractionOption.h"
-#include "Interaction/InteractionQuery.h"
-#include "Interaction/InteractionStatics.h"
-#include "Physics/UR_CollisionChannels.h"
+#include "Interaction/UR_InteractionSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_GrantNearbyInteraction)
 
@@ -38,62 +32,36 @@ void UAbilityTask_GrantNearbyInteraction::Activate()
 {
     SetWaitingOnAvatar();
 
-    UWorld* World = GetWorld();
-    World->GetTimerManager().SetTimer(QueryTimerHandle, this, &ThisClass::QueryInteractables, InteractionScanRate, true);
+    if (UUR_InteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<UUR_InteractionSubsystem>(GetWorld()))
+    {
+        InteractionSubsystem->RegisterScanner(this, InteractionScanRange, InteractionScanRate);
+    }
 }
 
 void UAbilityTask_GrantNearbyInteraction::OnDestroy(bool AbilityEnded)
 {
-    if (UWorld* World = GetWorld())
+    if (UUR_InteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<UUR_InteractionSubsystem>(GetWorld()))
     {
-        World->GetTimerManager().ClearTimer(QueryTimerHandle);
+        InteractionSubsystem->UnregisterScanner(this);
     }
 
     Super::OnDestroy(AbilityEnded);
 }
 
-void UAbilityTask_GrantNearbyInteraction::QueryInteractables()
+void UAbilityTask_GrantNearbyInteraction::OnInteractionOptionsChanged(TConstArrayView<FInteractionOption> AddedOptions, TConstArrayView<FInteractionOption> RemovedOptions)
 {
-    UWorld* World = GetWorld();
-    AActor* ActorOwner = GetAvatarActor();
-
-    if (World && ActorOwner)
+    // Check if any of the new options need to grant the ability to the user before they can be used.
+    for (const FInteractionOption& Option : AddedOptions)
     {
-        FCollisionQueryParams Params(SCENE_QUERY_STAT(UAbilityTask_GrantNearbyInteraction), false);
-
-        TArray<FOverlapResult> OverlapResults;
-        World->OverlapMultiByChannel(OUT OverlapResults, ActorOwner->GetActorLocation(), FQuat::Identity, Game_TraceChannel_Interaction, FCollisionShape::MakeSphere(InteractionScanRange), Params);
-
-        if (OverlapResults.Num() > 0)
+        if (Option.InteractionAbilityToGrant)
         {
-            TArray<TScriptInterface<IInteractableTarget>> InteractableTargets;
-            UInteractionStatics::AppendInteractableTargetsFromOverlapResults(OverlapResults, OUT InteractableTargets);
-
-            FInteractionQuery InteractionQuery;
-            InteractionQuery.RequestingAvatar = ActorOwner;
-            InteractionQuery.RequestingController = Cast<AController>(ActorOwner->GetOwner());
-
-            TArray<FInteractionOption> Options;
-            for (TScriptInterface<IInteractableTarget>& InteractiveTarget : InteractableTargets)
-            {
-                FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
-                InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
-            }
-
-            // Check if any of the options need to grant the ability to the user before they can be used.
-            for (FInteractionOption& Option : Options)
+            // Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
+            FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
+            if (!InteractionAbilityCache.Find(ObjectKey))
             {
-                if (Option.InteractionAbilityToGrant)
-                {
-                    // Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
-                    FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
-                    if (!InteractionAbilityCache.Find(ObjectKey))
-                    {
-                        FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
-                        FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
-                        InteractionAbilityCache.Add(ObjectKey, Handle);
-                    }
-                }
+                FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
+                FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
+                InteractionAbilityCache.Add(ObjectKey, Handle);
             }
         }
     }
@@ -12,6 +12,7 @@
 
 class UGameplayAbility;
 class UObject;
+struct FInteractionOption;
 struct FFrame;
 struct FGameplayAbilitySpecHandle;
 struct FObjectKey;
@@ -33,15 +34,14 @@ public:
     UFUNCTION(BlueprintCallable, Category="Ability|Tasks", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "TRUE"))
     static UAbilityTask_GrantNearbyInteraction* GrantAbilitiesForNearbyInteractors(UGameplayAbility* OwningAbility, float InteractionScanRange, float InteractionScanRate);
 
+    /** Called by UUR_InteractionSubsystem with the options that appeared or disappeared since the last scan */
+    void OnInteractionOptionsChanged(TConstArrayView<FInteractionOption> AddedOptions, TConstArrayView<FInteractionOption> RemovedOptions);
+
 private:
     virtual void OnDestroy(bool AbilityEnded) override;
 
-    void QueryInteractables();
-
     float InteractionScanRange = 100;
     float InteractionScanRate = 0.100;
 
-    FTimerHandle QueryTimerHandle;
-
     TMap<FObjectKey, FGameplayAbilitySpecHandle> InteractionAbilityCache;
 };
@@ -0,0 +1,441 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_InteractionSubsystem.h"
+
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+
+#include "IInteractableTarget.h"
+#include "InteractionQuery.h"
+#include "InteractionStatics.h"
+#include "Physics/UR_CollisionChannels.h"
+#include "Tasks/AbilityTask_GrantNearbyInteraction.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_InteractionSubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static float InteractionGridCellSize = 1000.f;
+    static FAutoConsoleVariableRef CVarInteractionGridCellSize
+    (
+        TEXT("OT.Interaction.GridCellSize"),
+        InteractionGridCellSize,
+        TEXT("Cell size of the interactable target grid. Read when a world is created."),
+        ECVF_Default
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_InteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CellSize = FMath::Max(OTConsoleVariables::InteractionGridCellSize, 100.f);
+}
+
+void UUR_InteractionSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ScanTimerHandle);
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+
+    for (const FInteractableEntry& Entry : Entries)
+    {
+        if (USceneComponent* Root = Entry.Root.Get())
+        {
+            Root->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+        }
+    }
+
+    Entries.Empty();
+    EntryIndexByActor.Empty();
+    Grid.Empty();
+    PendingActors.Empty();
+    Scanners.Empty();
+
+    Super::Deinitialize();
+}
+
+void UUR_InteractionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    for (TActorIterator<AActor> It(&InWorld); It; ++It)
+    {
+        RegisterInteractableActor(*It);
+    }
+
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::OnActorSpawned));
+    ActorDestroyedHandle = InWorld.AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &ThisClass::OnActorDestroyed));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_InteractionSubsystem::RegisterInteractableActor(AActor* Actor)
+{
+    if (Actor == nullptr || EntryIndexByActor.Contains(Actor))
+    {
+        return;
+    }
+
+    TArray<TScriptInterface<IInteractableTarget>> Targets;
+    UInteractionStatics::GetInteractableTargetsFromActor(Actor, Targets);
+    if (Targets.Num() == 0)
+    {
+        return;
+    }
+
+    FInteractableEntry Entry;
+    Entry.Actor = Actor;
+    for (const TScriptInterface<IInteractableTarget>& Target : Targets)
+    {
+        Entry.Targets.Add(Target.GetObject());
+    }
+
+    // Same as the overlap scan this replaces, targets without interaction collision can't be found.
+    // Components of deferred spawns and replicated actors may not be registered yet, those are retried.
+    if (!CaptureBounds(Entry))
+    {
+        if (!Actor->HasActorBegunPlay())
+        {
+            PendingActors.AddUnique(Actor);
+        }
+        return;
+    }
+
+    USceneComponent* Root = Actor->GetRootComponent();
+    if (Root && Root->Mobility == EComponentMobility::Movable)
+    {
+        Entry.Root = Root;
+        Entry.TransformUpdatedHandle = Root->TransformUpdated.AddUObject(this, &ThisClass::OnInteractableMoved);
+    }
+
+    const int32 EntryIndex = Entries.Add(MoveTemp(Entry));
+    EntryIndexByActor.Add(Actor, EntryIndex);
+    AddToGrid(EntryIndex);
+}
+
+void UUR_InteractionSubsystem::UnregisterInteractableActor(AActor* Actor)
+{
+    int32 EntryIndex;
+    if (EntryIndexByActor.RemoveAndCopyValue(Actor, EntryIndex))
+    {
+        const FInteractableEntry& Entry = Entries[EntryIndex];
+        if (USceneComponent* Root = Entry.Root.Get())
+        {
+            Root->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+        }
+
+        RemoveFromGrid(EntryIndex);
+        Entries.RemoveAt(EntryIndex);
+    }
+}
+
+void UUR_InteractionSubsystem::UpdateInteractableActor(AActor* Actor)
+{
+    if (const int32* EntryIndex = EntryIndexByActor.Find(Actor))
+    {
+        RemoveFromGrid(*EntryIndex);
+        if (CaptureBounds(Entries[*EntryIndex]))
+        {
+            AddToGrid(*EntryIndex);
+        }
+        else
+        {
+            UnregisterInteractableActor(Actor);
+        }
+    }
+    else
+    {
+        RegisterInteractableActor(Actor);
+    }
+}
+
+void UUR_InteractionSubsystem::GatherTargetsInRange(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutTargets) const
+{
+    const float SearchRadius = Range + MaxTargetRadius;
+    const FIntVector MinCell = GetCell(Location - FVector(SearchRadius));
+    const FIntVector MaxCell = GetCell(Location + FVector(SearchRadius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const TArray<int32>* CellEntries = Grid.Find(FIntVector(X, Y, Z));
+                if (CellEntries == nullptr)
+                {
+                    continue;
+                }
+
+                for (const int32 EntryIndex : *CellEntries)
+                {
+                    const FInteractableEntry& Entry = Entries[EntryIndex];
+                    if (FVector::DistSquared(Location, Entry.Location) > FMath::Square(Range + Entry.Radius))
+                    {
+                        continue;
+                    }
+
+                    for (const TWeakObjectPtr<UObject>& Target : Entry.Targets)
+                    {
+                        if (UObject* TargetObject = Target.Get())
+                        {
+                            OutTargets.Add(TScriptInterface<IInteractableTarget>(TargetObject));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+FIntVector UUR_InteractionSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntVector(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize), FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+bool UUR_InteractionSubsystem::CaptureBounds(FInteractableEntry& Entry) const
+{
+    const AActor* Actor = Entry.Actor.Get();
+    if (Actor == nullptr)
+    {
+        return false;
+    }
+
+    FBox Bounds(ForceInit);
+    Actor->ForEachComponent<UPrimitiveComponent>(false, [&Bounds](const UPrimitiveComponent* Primitive)
+    {
+        if (Primitive->IsRegistered() && Primitive->IsQueryCollisionEnabled() && Primitive->GetCollisionResponseToChannel(Game_TraceChannel_Interaction) != ECR_Ignore)
+        {
+            Bounds += Primitive->Bounds.GetBox();
+        }
+    });
+
+    if (!Bounds.IsValid)
+    {
+        return false;
+    }
+
+    FVector Extent;
+    Bounds.GetCenterAndExtents(Entry.Location, Extent);
+    Entry.Radius = Extent.Size();
+    Entry.Cell = GetCell(Entry.Location);
+    return true;
+}
+
+void UUR_InteractionSubsystem::AddToGrid(int32 EntryIndex)
+{
+    const FInteractableEntry& Entry = Entries[EntryIndex];
+    Grid.FindOrAdd(Entry.Cell).Add(EntryIndex);
+    MaxTargetRadius = FMath::Max(MaxTargetRadius, Entry.Radius);
+}
+
+void UUR_InteractionSubsystem::RemoveFromGrid(int32 EntryIndex)
+{
+    const FIntVector Cell = Entries[EntryIndex].Cell;
+    if (TArray<int32>* CellEntries = Grid.Find(Cell))
+    {
+        CellEntries->RemoveSingleSwap(EntryIndex);
+        if (CellEntries->Num() == 0)
+        {
+            Grid.Remove(Cell);
+        }
+    }
+}
+
+void UUR_InteractionSubsystem::OnActorSpawned(AActor* Actor)
+{
+    RegisterInteractableActor(Actor);
+}
+
+void UUR_InteractionSubsystem::OnActorDestroyed(AActor* Actor)
+{
+    PendingActors.Remove(Actor);
+    UnregisterInteractableActor(Actor);
+}
+
+void UUR_InteractionSubsystem::OnInteractableMoved(USceneComponent* Root, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    UpdateInteractableActor(Root->GetOwner());
+}
+
+void UUR_InteractionSubsystem::RegisterPendingActors()
+{
+    if (PendingActors.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<AActor>> ActorsToRetry = MoveTemp(PendingActors);
+    for (const TWeakObjectPtr<AActor>& Actor : ActorsToRetry)
+    {
+        // Re-added if still not ready. Once begun play its components are registered, so this is the last attempt.
+        RegisterInteractableActor(Actor.Get());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_InteractionSubsystem::RegisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner, float ScanRange, float ScanRate)
+{
+    check(Scanner);
+
+    FScanner& NewScanner = Scanners.AddDefaulted_GetRef();
+    NewScanner.Task = Scanner;
+    NewScanner.Range = ScanRange;
+    NewScanner.Rate = FMath::Max(ScanRate, UE_KINDA_SMALL_NUMBER);
+    NewScanner.TimeUntilScan = NewScanner.Rate;
+
+    UpdateScanTimer();
+}
+
+void UUR_InteractionSubsystem::UnregisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner)
+{
+    Scanners.RemoveAll([Scanner](const FScanner& Existing)
+    {
+        return Existing.Task == Scanner;
+    });
+
+    UpdateScanTimer();
+}
+
+void UUR_InteractionSubsystem::UpdateScanTimer()
+{
+    float NewInterval = 0.f;
+    for (const FScanner& Scanner : Scanners)
+    {
+        NewInterval = (NewInterval > 0.f) ? FMath::Min(NewInterval, Scanner.Rate) : Scanner.Rate;
+    }
+
+    if (NewInterval == ScanInterval)
+    {
+        return;
+    }
+
+    ScanInterval = NewInterval;
+
+    UWorld* World = GetWorld();
+    if (ScanInterval > 0.f)
+    {
+        World->GetTimerManager().SetTimer(ScanTimerHandle, this, &ThisClass::ScanAll, ScanInterval, true);
+    }
+    else
+    {
+        World->GetTimerManager().ClearTimer(ScanTimerHandle);
+    }
+}
+
+void UUR_InteractionSubsystem::ScanAll()
+{
+    struct FOptionsChange
+    {
+        TWeakObjectPtr<UAbilityTask_GrantNearbyInteraction> Task;
+        TArray<FInteractionOption> AddedOptions;
+        TArray<FInteractionOption> RemovedOptions;
+    };
+
+    // Scratch arrays reused across scanners
+    TArray<TScriptInterface<IInteractableTarget>> Targets;
+    TArray<FInteractionOption> Options;
+
+    // Tasks are notified after the batch, they may unregister in response
+    TArray<FOptionsChange> Changes;
+
+    bool bHasStaleScanners = false;
+
+    RegisterPendingActors();
+
+    for (int32 ScannerIndex = 0; ScannerIndex < Scanners.Num(); ++ScannerIndex)
+    {
+        FScanner& Scanner = Scanners[ScannerIndex];
+
+        // The scanner's rate may be slower than the shared interval
+        Scanner.TimeUntilScan -= ScanInterval;
+        if (Scanner.TimeUntilScan > UE_KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+        Scanner.TimeUntilScan += Scanner.Rate;
+
+        UAbilityTask_GrantNearbyInteraction* Task = Scanner.Task.Get();
+        if (Task == nullptr)
+        {
+            bHasStaleScanners = true;
+            continue;
+        }
+
+        AActor* Avatar = Task->GetAvatarActor();
+        if (Avatar == nullptr)
+        {
+            continue;
+        }
+
+        Targets.Reset();
+        GatherTargetsInRange(Avatar->GetActorLocation(), Scanner.Range, Targets);
+
+        FInteractionQuery InteractionQuery;
+        InteractionQuery.RequestingAvatar = Avatar;
+        InteractionQuery.RequestingController = Cast<AController>(Avatar->GetOwner());
+
+        Options.Reset();
+        for (TScriptInterface<IInteractableTarget>& InteractiveTarget : Targets)
+        {
+            FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
+            InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
+        }
+
+        FOptionsChange Change;
+        for (const FInteractionOption& Option : Options)
+        {
+            if (!Scanner.CurrentOptions.Contains(Option))
+            {
+                Change.AddedOptions.Add(Option);
+            }
+        }
+        for (const FInteractionOption& Option : Scanner.CurrentOptions)
+        {
+            if (!Options.Contains(Option))
+            {
+                Change.RemovedOptions.Add(Option);
+            }
+        }
+
+        if (Change.AddedOptions.Num() > 0 || Change.RemovedOptions.Num() > 0)
+        {
+            Swap(Scanner.CurrentOptions, Options);
+            Change.Task = Task;
+            Changes.Add(MoveTemp(Change));
+        }
+    }
+
+    if (bHasStaleScanners)
+    {
+        Scanners.RemoveAll([](const FScanner& Scanner)
+        {
+            return !Scanner.Task.IsValid();
+        });
+        UpdateScanTimer();
+    }
+
+    for (const FOptionsChange& Change : Changes)
+    {
+        if (UAbilityTask_GrantNearbyInteraction* Task = Change.Task.Get())
+        {
+            Task->OnInteractionOptionsChanged(Change.AddedOptions, Change.RemovedOptions);
+        }
+    }
+}
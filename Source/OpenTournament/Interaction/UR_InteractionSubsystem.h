@@ -0,0 +1,132 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "InteractionOption.h"
+
+#include "UR_InteractionSubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+class FSubsystemCollectionBase;
+class USceneComponent;
+enum class ETeleportType : uint8;
+enum class EUpdateTransformFlags : int32;
+class IInteractableTarget;
+class UAbilityTask_GrantNearbyInteraction;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Indexes interactable targets in a uniform grid and runs the nearby interaction scans of all players.
+ *
+ * A target's location and bounds (from components that respond to Game_TraceChannel_Interaction) are
+ * captured when registered, and again whenever the root component of a movable target moves.
+ * Actors are registered automatically when the world begins play or when they spawn. An actor whose
+ * components are not registered yet (deferred spawns, replicated actors on clients) is retried before
+ * each scan until it has begun play.
+ *
+ * Every scan interval all scanners are answered in one batch, and a scanner is only notified
+ * when options appear or disappear compared to its previous scan.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_InteractionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    //~UWorldSubsystem interface
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    //~End of UWorldSubsystem interface
+
+    // Registers the actor if it or any of its components implement IInteractableTarget
+    void RegisterInteractableActor(AActor* Actor);
+
+    void UnregisterInteractableActor(AActor* Actor);
+
+    // Re-captures the location and bounds of a registered actor, eg. after teleporting a static one
+    UFUNCTION(BlueprintCallable, Category = "Interaction")
+    void UpdateInteractableActor(AActor* Actor);
+
+    // Scans around the scanner's avatar every ScanRate seconds until unregistered
+    void RegisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner, float ScanRange, float ScanRate);
+
+    void UnregisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner);
+
+    // Appends registered targets whose bounds are within Range of Location
+    void GatherTargetsInRange(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutTargets) const;
+
+private:
+    struct FInteractableEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+
+        // The actor and/or its components implementing IInteractableTarget
+        TArray<TWeakObjectPtr<UObject>, TInlineAllocator<2>> Targets;
+
+        FVector Location = FVector::ZeroVector;
+        float Radius = 0.f;
+        FIntVector Cell = FIntVector::ZeroValue;
+
+        // Bound on the root component of movable targets
+        TWeakObjectPtr<USceneComponent> Root;
+        FDelegateHandle TransformUpdatedHandle;
+    };
+
+    struct FScanner
+    {
+        TWeakObjectPtr<UAbilityTask_GrantNearbyInteraction> Task;
+        float Range = 0.f;
+        float Rate = 0.f;
+        float TimeUntilScan = 0.f;
+
+        // Options reported by the last scan
+        TArray<FInteractionOption> CurrentOptions;
+    };
+
+    FIntVector GetCell(const FVector& Location) const;
+
+    bool CaptureBounds(FInteractableEntry& Entry) const;
+
+    void AddToGrid(int32 EntryIndex);
+    void RemoveFromGrid(int32 EntryIndex);
+
+    void OnActorSpawned(AActor* Actor);
+    void OnActorDestroyed(AActor* Actor);
+
+    void OnInteractableMoved(USceneComponent* Root, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+    // Retries actors that were not ready to be registered
+    void RegisterPendingActors();
+
+    void UpdateScanTimer();
+    void ScanAll();
+
+    TSparseArray<FInteractableEntry> Entries;
+    TMap<FObjectKey, int32> EntryIndexByActor;
+    TMap<FIntVector, TArray<int32>> Grid;
+
+    // Interactable actors whose interaction components were not registered yet
+    TArray<TWeakObjectPtr<AActor>> PendingActors;
+    float CellSize = 1000.f;
+
+    // Largest registered radius, queries are expanded by it so targets only live in one cell
+    float MaxTargetRadius = 0.f;
+
+    TArray<FScanner> Scanners;
+    float ScanInterval = 0.f;
+    FTimerHandle ScanTimerHandle;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+};
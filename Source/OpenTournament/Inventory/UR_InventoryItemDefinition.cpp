@@ -17,19 +17,60 @@ UUR_InventoryItemDefinition::UUR_InventoryItemDefinition(const FObjectInitialize
 {
 }
 
-const UUR_InventoryItemFragment* UUR_InventoryItemDefinition::FindFragmentByClass(TSubclassOf<UUR_InventoryItemFragment> FragmentClass) const
+void UUR_InventoryItemDefinition::PostLoad()
 {
-    if (FragmentClass != nullptr)
+    Super::PostLoad();
+
+    BuildFragmentLookup();
+}
+
+#if WITH_EDITOR
+void UUR_InventoryItemDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    bFragmentLookupBuilt = false;
+}
+#endif
+
+void UUR_InventoryItemDefinition::BuildFragmentLookup() const
+{
+    FragmentLookup.Reset();
+
+    for (const UUR_InventoryItemFragment* Fragment : Fragments)
     {
-        for (UUR_InventoryItemFragment* Fragment : Fragments)
+        if (Fragment == nullptr)
         {
-            if (Fragment && Fragment->IsA(FragmentClass))
+            continue;
+        }
+
+        // Register the whole class chain so queries for a parent fragment class resolve the same way IsA did
+        for (const UClass* Class = Fragment->GetClass(); Class && Class->IsChildOf(UUR_InventoryItemFragment::StaticClass()); Class = Class->GetSuperClass())
+        {
+            // First fragment wins, same as the linear scan
+            if (!FragmentLookup.Contains(Class))
             {
-                return Fragment;
+                FragmentLookup.Add(Class, Fragment);
             }
         }
     }
 
+    bFragmentLookupBuilt = true;
+}
+
+const UUR_InventoryItemFragment* UUR_InventoryItemDefinition::FindFragmentByClass(TSubclassOf<UUR_InventoryItemFragment> FragmentClass) const
+{
+    if (FragmentClass != nullptr)
+    {
+        // Blueprint CDOs may be queried before PostLoad ran on them
+        if (!bFragmentLookupBuilt)
+        {
+            BuildFragmentLookup();
+        }
+
+        return FragmentLookup.FindRef(FragmentClass.Get());
+    }
+
     return nullptr;
 }
 
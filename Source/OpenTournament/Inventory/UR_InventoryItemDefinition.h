@@ -50,7 +50,22 @@ public:
     TArray<TObjectPtr<UUR_InventoryItemFragment>> Fragments;
 
 public:
+    //~UObject interface
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+    //~End of UObject interface
+
     const UUR_InventoryItemFragment* FindFragmentByClass(TSubclassOf<UUR_InventoryItemFragment> FragmentClass) const;
+
+private:
+    void BuildFragmentLookup() const;
+
+    // Maps every fragment class (and its parent fragment classes) to the first fragment that IsA it.
+    // Fragments are kept alive by the Fragments array.
+    mutable TMap<const UClass*, const UUR_InventoryItemFragment*> FragmentLookup;
+    mutable bool bFragmentLookupBuilt = false;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +49,8 @@ void FUR_InventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndic
         BroadcastChangeMessage(Stack, /*OldCount=*/ Stack.StackCount, /*NewCount=*/ 0);
         Stack.LastObservedCount = 0;
     }
+
+    MarkItemIndexDirty();
 }
 
 void FUR_InventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
@@ -59,6 +61,8 @@ void FUR_InventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices,
         BroadcastChangeMessage(Stack, /*OldCount=*/ 0, /*NewCount=*/ Stack.StackCount);
         Stack.LastObservedCount = Stack.StackCount;
     }
+
+    MarkItemIndexDirty();
 }
 
 void FUR_InventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
@@ -70,6 +74,9 @@ void FUR_InventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndi
         BroadcastChangeMessage(Stack, /*OldCount=*/ Stack.LastObservedCount, /*NewCount=*/ Stack.StackCount);
         Stack.LastObservedCount = Stack.StackCount;
     }
+
+    // The instance pointer may have resolved since the entry was added
+    MarkItemIndexDirty();
 }
 
 void FUR_InventoryList::BroadcastChangeMessage(FUR_InventoryEntry& Entry, int32 OldCount, int32 NewCount)
@@ -110,6 +117,7 @@ UUR_InventoryItemInstance* FUR_InventoryList::AddEntry(TSubclassOf<UUR_Inventory
 
     //const UUR_InventoryItemDefinition* ItemCDO = GetDefault<UUR_InventoryItemDefinition>(ItemDef);
     MarkItemDirty(NewEntry);
+    MarkItemIndexDirty();
 
     return Result;
 }
@@ -128,22 +136,74 @@ void FUR_InventoryList::RemoveEntry(UUR_InventoryItemInstance* Instance)
         {
             EntryIt.RemoveCurrent();
             MarkArrayDirty();
+            MarkItemIndexDirty();
         }
     }
 }
 
 TArray<UUR_InventoryItemInstance*> FUR_InventoryList::GetAllItems() const
 {
-    TArray<UUR_InventoryItemInstance*> Results;
-    Results.Reserve(Entries.Num());
+    return TArray<UUR_InventoryItemInstance*>(GetItems());
+}
+
+TConstArrayView<UUR_InventoryItemInstance*> FUR_InventoryList::GetItems() const
+{
+    if (bItemIndexDirty)
+    {
+        RebuildItemIndex();
+    }
+
+    return AllItems;
+}
+
+TConstArrayView<UUR_InventoryItemInstance*> FUR_InventoryList::GetItemsByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const
+{
+    if (bItemIndexDirty)
+    {
+        RebuildItemIndex();
+    }
+
+    if (const TArray<UUR_InventoryItemInstance*>* Items = ItemsByDefinition.Find(ItemDef.Get()))
+    {
+        return *Items;
+    }
+
+    return TConstArrayView<UUR_InventoryItemInstance*>();
+}
+
+void FUR_InventoryList::RebuildItemIndex() const
+{
+    // Keep the per-definition arrays allocated, inventories cycle through the same few definitions
+    AllItems.Reset();
+    for (TPair<const UClass*, TArray<UUR_InventoryItemInstance*>>& Pair : ItemsByDefinition)
+    {
+        Pair.Value.Reset();
+    }
+
+    bool bHasUnresolvedEntries = false;
     for (const FUR_InventoryEntry& Entry : Entries)
     {
-        if (Entry.Instance != nullptr) //@TODO: Would prefer to not deal with this here and hide it further?
+        UUR_InventoryItemInstance* Instance = Entry.Instance;
+        if (Instance == nullptr) //@TODO: Would prefer to not deal with this here and hide it further?
         {
-            Results.Add(Entry.Instance);
+            bHasUnresolvedEntries = true;
+            continue;
         }
+
+        AllItems.Add(Instance);
+
+        // On clients the instance subobject can arrive before its replicated item definition
+        const UClass* ItemDef = Instance->GetItemDef();
+        if (ItemDef == nullptr)
+        {
+            bHasUnresolvedEntries = true;
+            continue;
+        }
+
+        ItemsByDefinition.FindOrAdd(ItemDef).Add(Instance);
     }
-    return Results;
+
+    bItemIndexDirty = bHasUnresolvedEntries;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -210,16 +270,11 @@ TArray<UUR_InventoryItemInstance*> UUR_InventoryManagerComponent::GetAllItems()
 
 UUR_InventoryItemInstance* UUR_InventoryManagerComponent::FindFirstItemStackByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const
 {
-    for (const FUR_InventoryEntry& Entry : InventoryList.Entries)
+    for (UUR_InventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
     {
-        UUR_InventoryItemInstance* Instance = Entry.Instance;
-
         if (IsValid(Instance))
         {
-            if (Instance->GetItemDef() == ItemDef)
-            {
-                return Instance;
-            }
+            return Instance;
         }
     }
 
@@ -229,16 +284,11 @@ UUR_InventoryItemInstance* UUR_InventoryManagerComponent::FindFirstItemStackByDe
 int32 UUR_InventoryManagerComponent::GetTotalItemCountByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const
 {
     int32 TotalCount = 0;
-    for (const FUR_InventoryEntry& Entry : InventoryList.Entries)
+    for (UUR_InventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
     {
-        UUR_InventoryItemInstance* Instance = Entry.Instance;
-
         if (IsValid(Instance))
         {
-            if (Instance->GetItemDef() == ItemDef)
-            {
-                ++TotalCount;
-            }
+            ++TotalCount;
         }
     }
 
@@ -253,22 +303,27 @@ bool UUR_InventoryManagerComponent::ConsumeItemsByDefinition(TSubclassOf<UUR_Inv
         return false;
     }
 
-    //@TODO: N squared right now as there's no acceleration structure
-    int32 TotalConsumed = 0;
-    while (TotalConsumed < NumToConsume)
+    // Copy out the instances first, removing entries invalidates the index view
+    TArray<UUR_InventoryItemInstance*, TInlineAllocator<8>> ToConsume;
+    for (UUR_InventoryItemInstance* Instance : InventoryList.GetItemsByDefinition(ItemDef))
     {
-        if (UUR_InventoryItemInstance* Instance = UUR_InventoryManagerComponent::FindFirstItemStackByDefinition(ItemDef))
+        if (ToConsume.Num() >= NumToConsume)
         {
-            InventoryList.RemoveEntry(Instance);
-            ++TotalConsumed;
+            break;
         }
-        else
+
+        if (IsValid(Instance))
         {
-            return false;
+            ToConsume.Add(Instance);
         }
     }
 
-    return TotalConsumed == NumToConsume;
+    for (UUR_InventoryItemInstance* Instance : ToConsume)
+    {
+        InventoryList.RemoveEntry(Instance);
+    }
+
+    return ToConsume.Num() == NumToConsume;
 }
 
 void UUR_InventoryManagerComponent::ReadyForReplication()
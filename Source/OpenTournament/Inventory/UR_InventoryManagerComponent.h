@@ -90,6 +90,12 @@ struct FUR_InventoryList : public FFastArraySerializer
 
     TArray<UUR_InventoryItemInstance*> GetAllItems() const;
 
+    // Non-null instances of all entries, in entry order. Valid until the list changes.
+    TConstArrayView<UUR_InventoryItemInstance*> GetItems() const;
+
+    // Instances whose item definition is exactly ItemDef, in entry order. Valid until the list changes.
+    TConstArrayView<UUR_InventoryItemInstance*> GetItemsByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const;
+
 public:
     //~FFastArraySerializer contract
     void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
@@ -114,6 +120,10 @@ public:
 private:
     void BroadcastChangeMessage(FUR_InventoryEntry& Entry, int32 OldCount, int32 NewCount);
 
+    void MarkItemIndexDirty() { bItemIndexDirty = true; }
+
+    void RebuildItemIndex() const;
+
 private:
     friend UUR_InventoryManagerComponent;
 
@@ -124,6 +134,14 @@ private:
 
     UPROPERTY(NotReplicated)
     TObjectPtr<UActorComponent> OwnerComponent;
+
+    // Lookup caches rebuilt lazily after the entries change, instances are kept alive by Entries
+    mutable TArray<UUR_InventoryItemInstance*> AllItems;
+    mutable TMap<const UClass*, TArray<UUR_InventoryItemInstance*>> ItemsByDefinition;
+
+    // Set on every add/remove/replicated change. Stays set on clients while an entry is still waiting
+    // for its instance or item definition to replicate.
+    mutable bool bItemIndexDirty = true;
 };
 
 template <>
@@ -161,6 +179,11 @@ public:
     UFUNCTION(BlueprintCallable, Category=Inventory, BlueprintPure=false)
     TArray<UUR_InventoryItemInstance*> GetAllItems() const;
 
+    // Native version of GetAllItems that does not copy
+    TConstArrayView<UUR_InventoryItemInstance*> GetItems() const { return InventoryList.GetItems(); }
+
+    TConstArrayView<UUR_InventoryItemInstance*> GetItemsByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const { return InventoryList.GetItemsByDefinition(ItemDef); }
+
     UFUNCTION(BlueprintCallable, Category=Inventory, BlueprintPure)
     UUR_InventoryItemInstance* FindFirstItemStackByDefinition(TSubclassOf<UUR_InventoryItemDefinition> ItemDef) const;
 
@@ -4,11 +4,36 @@
 
 #include "GameVerbMessageReplication.h"
 
+#include "Engine/World.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
+#include "GameFramework/GameStateBase.h"
 #include "Messages/GameVerbMessage.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GameVerbMessageReplication)
 
+//////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+	static float VerbMessageLifetime = 5.f;
+	static FAutoConsoleVariableRef CVarVerbMessageLifetime
+	(
+		TEXT("OT.Messages.VerbMessageLifetime"),
+		VerbMessageLifetime,
+		TEXT("Default time (in seconds) a replicated verb message stays in flight before being dropped."),
+		ECVF_Default
+	);
+
+	static int32 MaxVerbMessages = 32;
+	static FAutoConsoleVariableRef CVarMaxVerbMessages
+	(
+		TEXT("OT.Messages.MaxVerbMessages"),
+		MaxVerbMessages,
+		TEXT("Maximum number of replicated verb messages in flight, the oldest are dropped first."),
+		ECVF_Default
+	);
+}
+
 //////////////////////////////////////////////////////////////////////
 // FGameVerbMessageReplicationEntry
 
@@ -20,12 +45,52 @@ FString FGameVerbMessageReplicationEntry::GetDebugString() const
 //////////////////////////////////////////////////////////////////////
 // FGameVerbMessageReplication
 
-void FGameVerbMessageReplication::AddMessage(const FGameVerbMessage& Message)
+void FGameVerbMessageReplication::AddMessage(const FGameVerbMessage& Message, float Lifetime)
+{
+	AddMessageAt(Message, GetServerTime(), Lifetime);
+}
+
+void FGameVerbMessageReplication::AddMessageAt(const FGameVerbMessage& Message, float ServerTime, float Lifetime)
 {
-	FGameVerbMessageReplicationEntry& NewStack = CurrentMessages.Emplace_GetRef(Message);
+	PruneExpiredMessagesAt(ServerTime);
+
+	// Entries are kept in insertion order, the oldest is always first
+	const int32 MaxMessages = FMath::Max(1, OTConsoleVariables::MaxVerbMessages);
+	if (CurrentMessages.Num() >= MaxMessages)
+	{
+		CurrentMessages.RemoveAt(0, CurrentMessages.Num() - MaxMessages + 1, EAllowShrinking::No);
+		MarkArrayDirty();
+	}
+
+	const float ExpireTime = ServerTime + (Lifetime > 0.f ? Lifetime : OTConsoleVariables::VerbMessageLifetime);
+	FGameVerbMessageReplicationEntry& NewStack = CurrentMessages.Emplace_GetRef(Message, ExpireTime);
 	MarkItemDirty(NewStack);
 }
 
+void FGameVerbMessageReplication::PruneExpiredMessagesAt(float ServerTime)
+{
+	const int32 NumRemoved = CurrentMessages.RemoveAll([ServerTime](const FGameVerbMessageReplicationEntry& Entry)
+	{
+		return Entry.ExpireTime <= ServerTime;
+	}, EAllowShrinking::No);
+
+	if (NumRemoved > 0)
+	{
+		MarkArrayDirty();
+	}
+}
+
+bool FGameVerbMessageReplication::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	// Writing to a client, never send what has already expired
+	if (DeltaParms.Writer != nullptr)
+	{
+		PruneExpiredMessagesAt(GetServerTime());
+	}
+
+	return FFastArraySerializer::FastArrayDeltaSerialize<FGameVerbMessageReplicationEntry, FGameVerbMessageReplication>(CurrentMessages, DeltaParms, *this);
+}
+
 void FGameVerbMessageReplication::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
 {
 // 	for (int32 Index : RemovedIndices)
@@ -37,19 +102,28 @@ void FGameVerbMessageReplication::PreReplicatedRemove(const TArrayView<int32> Re
 
 void FGameVerbMessageReplication::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
 {
+	const float ServerTime = GetServerTime();
 	for (int32 Index : AddedIndices)
 	{
+		// May have expired in transit
 		const FGameVerbMessageReplicationEntry& Entry = CurrentMessages[Index];
-		RebroadcastMessage(Entry.Message);
+		if (Entry.ExpireTime > ServerTime)
+		{
+			RebroadcastMessage(Entry.Message);
+		}
 	}
 }
 
 void FGameVerbMessageReplication::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
 {
+	const float ServerTime = GetServerTime();
 	for (int32 Index : ChangedIndices)
 	{
 		const FGameVerbMessageReplicationEntry& Entry = CurrentMessages[Index];
-		RebroadcastMessage(Entry.Message);
+		if (Entry.ExpireTime > ServerTime)
+		{
+			RebroadcastMessage(Entry.Message);
+		}
 	}
 }
 
@@ -60,3 +134,18 @@ void FGameVerbMessageReplication::RebroadcastMessage(const FGameVerbMessage& Mes
 	MessageSystem.BroadcastMessage(Message.Verb, Message);
 }
 
+float FGameVerbMessageReplication::GetServerTime() const
+{
+	const UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (World == nullptr)
+	{
+		return 0.f;
+	}
+
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return World->GetTimeSeconds();
+}
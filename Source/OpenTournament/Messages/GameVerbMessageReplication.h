@@ -25,8 +25,9 @@ struct FGameVerbMessageReplicationEntry : public FFastArraySerializerItem
 	FGameVerbMessageReplicationEntry()
 	{}
 
-	FGameVerbMessageReplicationEntry(const FGameVerbMessage& InMessage)
+	FGameVerbMessageReplicationEntry(const FGameVerbMessage& InMessage, float InExpireTime)
 		: Message(InMessage)
+		, ExpireTime(InExpireTime)
 	{
 	}
 
@@ -37,11 +38,22 @@ private:
 
 	UPROPERTY()
 	FGameVerbMessage Message;
+
+	// Server world time after which the message is dropped and no longer sent or rebroadcast
+	UPROPERTY()
+	float ExpireTime = 0.f;
 };
 
-/** Container of verb messages to replicate */
+/**
+ * Container of verb messages to replicate.
+ *
+ * Only recent messages are kept: each entry expires after its lifetime (OT.Messages.VerbMessageLifetime by default),
+ * and at most OT.Messages.MaxVerbMessages are in flight, the oldest being dropped first.
+ * Expired entries are dropped when the next message is added and before the stream is written to any client, so a
+ * late joiner is never sent one, and clients never rebroadcast a message that expired in transit.
+ */
 USTRUCT(BlueprintType)
-struct FGameVerbMessageReplication : public FFastArraySerializer
+struct OPENTOURNAMENT_API FGameVerbMessageReplication : public FFastArraySerializer
 {
 	GENERATED_BODY()
 
@@ -52,8 +64,18 @@ struct FGameVerbMessageReplication : public FFastArraySerializer
 public:
 	void SetOwner(UObject* InOwner) { Owner = InOwner; }
 
-	// Broadcasts a message from server to clients
-	void AddMessage(const FGameVerbMessage& Message);
+	// Broadcasts a message from server to clients, Lifetime <= 0 uses the default lifetime
+	void AddMessage(const FGameVerbMessage& Message, float Lifetime = 0.f);
+
+	// Same as AddMessage with an explicit server world time
+	void AddMessageAt(const FGameVerbMessage& Message, float ServerTime, float Lifetime = 0.f);
+
+	// Drops the messages expired at ServerTime, adding a message and replicating the stream do it first
+	void PruneExpiredMessagesAt(float ServerTime);
+
+	int32 GetNumMessages() const { return CurrentMessages.Num(); }
+
+	SIZE_T GetAllocatedSize() const { return CurrentMessages.GetAllocatedSize(); }
 
 	//~FFastArraySerializer contract
 	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
@@ -61,14 +83,13 @@ public:
 	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
 	//~End of FFastArraySerializer contract
 
-	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
-	{
-		return FFastArraySerializer::FastArrayDeltaSerialize<FGameVerbMessageReplicationEntry, FGameVerbMessageReplication>(CurrentMessages, DeltaParms, *this);
-	}
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
 
 private:
 	void RebroadcastMessage(const FGameVerbMessage& Message);
 
+	float GetServerTime() const;
+
 private:
 	// Replicated list of gameplay tag stacks
 	UPROPERTY()
@@ -123,6 +123,7 @@ public class OpenTournament : ModuleRules
                 "Projects",
                 "RenderCore",
                 "RHI",
+                "SkeletalMerging",
                 "Slate",
                 "SlateCore",
                 "UIExtension",
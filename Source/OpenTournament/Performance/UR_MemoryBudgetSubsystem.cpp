@@ -0,0 +1,424 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_MemoryBudgetSubsystem.h"
+
+#include <Engine/World.h>
+#include <GameFramework/GameStateBase.h>
+#include <HAL/FileManager.h>
+#include <HAL/IConsoleManager.h>
+#include <HAL/LowLevelMemTracker.h>
+#include <HAL/PlatformMemory.h>
+#include <Misc/DateTime.h>
+#include <Misc/Paths.h>
+#include <TimerManager.h>
+#include <UObject/Package.h>
+#include <UObject/UObjectArray.h>
+#include <UObject/UObjectHash.h>
+
+#include "UR_ActorRegistrySubsystem.h"
+#include "UR_ExperienceDefinition.h"
+#include "UR_ExperienceManagerComponent.h"
+#include "UR_LogChannels.h"
+#include "Cosmetics/UR_CharacterPartPoolSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_MemoryBudgetSubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static float MemorySampleInterval = 10.f;
+    static FAutoConsoleVariableRef CVarMemorySampleInterval
+    (
+        TEXT("OT.Memory.SampleInterval"),
+        MemorySampleInterval,
+        TEXT("Seconds between two samples of the match memory checked against the experience memory budget, applied when a match starts. 0 disables sampling."),
+        ECVF_Default
+    );
+
+    static bool bMemoryWriteCsv = false;
+    static FAutoConsoleVariableRef CVarMemoryWriteCsv
+    (
+        TEXT("OT.Memory.WriteCsv"),
+        bMemoryWriteCsv,
+        TEXT("Writes the match memory samples to Saved/Profiling/MemoryBudget as CSV, applied when a match starts."),
+        ECVF_Default
+    );
+
+    static FAutoConsoleCommandWithWorld CVarDumpMemoryBudget
+    (
+        TEXT("OT.Memory.DumpBudget"),
+        TEXT("Samples the match memory now and shows it against the experience memory budget."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (UUR_MemoryBudgetSubsystem* MemoryBudget = UWorld::GetSubsystem<UUR_MemoryBudgetSubsystem>(World))
+            {
+                if (MemoryBudget->IsSampling())
+                {
+                    MemoryBudget->Sample();
+                }
+                MemoryBudget->DumpBudget();
+            }
+        })
+    );
+}
+
+namespace URMemoryBudget
+{
+    static constexpr double BytesPerMB = 1024.0 * 1024.0;
+
+    // Negative when LLM is not running
+    static double GetLLMTagMB(FName Tag)
+    {
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+        if (FLowLevelMemTracker::IsEnabled())
+        {
+            return FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, Tag, ELLMTagSet::None) / BytesPerMB;
+        }
+#endif
+        return -1.0;
+    }
+
+    static FString GetClassName(const FUR_ObjectCountBudget& ObjectCount)
+    {
+        return ObjectCount.Class.ToSoftObjectPath().GetAssetName();
+    }
+
+    static const TCHAR* GetNetModeName(ENetMode NetMode)
+    {
+        switch (NetMode)
+        {
+            case NM_DedicatedServer: return TEXT("Server");
+            case NM_ListenServer: return TEXT("ListenServer");
+            case NM_Client: return TEXT("Client");
+            default: return TEXT("Standalone");
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_MemoryBudgetSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GameStateSetEvent.RemoveAll(this);
+        World->GetTimerManager().ClearTimer(SampleTimerHandle);
+    }
+
+    if (IsSampling())
+    {
+        UE_LOG(LogGame, Log, TEXT("Match memory (%s): %.1f MB -> %.1f MB (%+.1f MB), %d UObjects -> %d, %d samples, %d budget warnings"),
+            *ExperienceName, Samples[0].UsedPhysicalMB, Samples.Last().UsedPhysicalMB, GetMatchGrowthMB(),
+            Samples[0].NumObjects, Samples.Last().NumObjects, NumSamples, NumBudgetWarnings);
+    }
+
+    CloseCsv();
+    Samples.Empty();
+    OverBudget.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UUR_MemoryBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UUR_MemoryBudgetSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (OTConsoleVariables::MemorySampleInterval <= 0.f)
+    {
+        return;
+    }
+
+    // Clients get the game state once it is replicated
+    if (AGameStateBase* GameState = InWorld.GetGameState())
+    {
+        OnGameStateSet(GameState);
+    }
+    else
+    {
+        InWorld.GameStateSetEvent.AddUObject(this, &ThisClass::OnGameStateSet);
+    }
+}
+
+void UUR_MemoryBudgetSubsystem::OnGameStateSet(AGameStateBase* GameState)
+{
+    GetWorld()->GameStateSetEvent.RemoveAll(this);
+
+    if (UUR_ExperienceManagerComponent* ExperienceComponent = GameState ? GameState->FindComponentByClass<UUR_ExperienceManagerComponent>() : nullptr)
+    {
+        ExperienceComponent->CallOrRegister_OnExperienceLoaded_LowPriority(FOnGameExperienceLoaded::FDelegate::CreateUObject(this, &ThisClass::OnExperienceLoaded));
+    }
+}
+
+void UUR_MemoryBudgetSubsystem::OnExperienceLoaded(const UUR_ExperienceDefinition* Experience)
+{
+    Budget = Experience->MemoryBudget;
+    ExperienceName = Experience->GetPrimaryAssetId().ToString();
+
+    if (OTConsoleVariables::bMemoryWriteCsv)
+    {
+        OpenCsv();
+    }
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    const bool bLLMEnabled = FLowLevelMemTracker::IsEnabled();
+#else
+    const bool bLLMEnabled = false;
+#endif
+    if (Budget.LLMTags.Num() > 0 && !bLLMEnabled)
+    {
+        UE_LOG(LogGame, Log, TEXT("LLM is not running (-llm), the LLM tag budgets of %s are not checked"), *ExperienceName);
+    }
+
+    ResetBaseline();
+
+    GetWorld()->GetTimerManager().SetTimer(SampleTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this]()
+    {
+        Sample();
+    }), OTConsoleVariables::MemorySampleInterval, true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+const FUR_MemorySample& UUR_MemoryBudgetSubsystem::Sample()
+{
+    const FUR_MemorySample MemorySample = TakeSample();
+    CheckBudget(MemorySample);
+    WriteCsvRow(MemorySample);
+
+    if (Samples.Num() < 2)
+    {
+        Samples.Add(MemorySample);
+    }
+    else
+    {
+        Samples[1] = MemorySample;
+    }
+    NumSamples++;
+
+    return Samples.Last();
+}
+
+void UUR_MemoryBudgetSubsystem::ResetBaseline()
+{
+    Samples.Reset();
+    Sample();
+}
+
+double UUR_MemoryBudgetSubsystem::GetMatchGrowthMB() const
+{
+    return IsSampling() ? Samples.Last().UsedPhysicalMB - Samples[0].UsedPhysicalMB : 0.0;
+}
+
+FUR_MemorySample UUR_MemoryBudgetSubsystem::TakeSample() const
+{
+    const UWorld* World = GetWorld();
+
+    FUR_MemorySample MemorySample;
+    MemorySample.Time = World->GetTimeSeconds();
+    MemorySample.UsedPhysicalMB = FPlatformMemory::GetStats().UsedPhysical / URMemoryBudget::BytesPerMB;
+    MemorySample.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+    if (const UUR_CharacterPartPoolSubsystem* PartPool = UWorld::GetSubsystem<UUR_CharacterPartPoolSubsystem>(World))
+    {
+        MemorySample.NumPooledCharacterParts = PartPool->GetNumPooledActors();
+    }
+
+    MemorySample.NumRegisteredActors.SetNumZeroed(static_cast<int32>(EUR_ActorRegistryCategory::MAX));
+    if (const UUR_ActorRegistrySubsystem* Registry = UWorld::GetSubsystem<UUR_ActorRegistrySubsystem>(World))
+    {
+        for (int32 i = 0; i < MemorySample.NumRegisteredActors.Num(); i++)
+        {
+            MemorySample.NumRegisteredActors[i] = Registry->GetActors(static_cast<EUR_ActorRegistryCategory>(i)).Num();
+        }
+    }
+
+    for (const FUR_LLMTagBudget& TagBudget : Budget.LLMTags)
+    {
+        MemorySample.LLMTagMB.Add(URMemoryBudget::GetLLMTagMB(TagBudget.Tag));
+    }
+
+    // Goes through the class hash, so only walks the objects of the budgeted classes
+    for (const FUR_ObjectCountBudget& ObjectCount : Budget.ObjectCounts)
+    {
+        int32 Count = 0;
+        if (const UClass* Class = ObjectCount.Class.Get())
+        {
+            ForEachObjectOfClass(Class, [&Count](UObject*)
+            {
+                Count++;
+            }, true, RF_ClassDefaultObject, EInternalObjectFlags::Garbage);
+        }
+        MemorySample.ObjectCounts.Add(Count);
+    }
+
+    return MemorySample;
+}
+
+void UUR_MemoryBudgetSubsystem::CheckBudget(const FUR_MemorySample& MemorySample)
+{
+    CheckValue(TEXT("Used physical memory (MB)"), MemorySample.UsedPhysicalMB, Budget.MaxUsedPhysicalMB);
+    if (IsSampling())
+    {
+        CheckValue(TEXT("Match memory growth (MB)"), MemorySample.UsedPhysicalMB - Samples[0].UsedPhysicalMB, Budget.MaxMatchGrowthMB);
+    }
+    CheckValue(TEXT("UObjects"), MemorySample.NumObjects, Budget.MaxObjects);
+    CheckValue(TEXT("Pooled character parts"), MemorySample.NumPooledCharacterParts, Budget.MaxPooledCharacterParts);
+
+    for (int32 i = 0; i < Budget.LLMTags.Num(); i++)
+    {
+        if (MemorySample.LLMTagMB[i] >= 0.0)
+        {
+            CheckValue(FString::Printf(TEXT("LLM %s (MB)"), *Budget.LLMTags[i].Tag.ToString()), MemorySample.LLMTagMB[i], Budget.LLMTags[i].MaxMB);
+        }
+    }
+
+    for (int32 i = 0; i < Budget.ObjectCounts.Num(); i++)
+    {
+        CheckValue(FString::Printf(TEXT("%s objects"), *URMemoryBudget::GetClassName(Budget.ObjectCounts[i])), MemorySample.ObjectCounts[i], Budget.ObjectCounts[i].MaxCount);
+    }
+}
+
+void UUR_MemoryBudgetSubsystem::CheckValue(const FString& Name, double Value, double Max)
+{
+    if (Max <= 0.0)
+    {
+        return;
+    }
+
+    if (Value > Max)
+    {
+        bool bAlreadyOver = false;
+        OverBudget.Add(Name, &bAlreadyOver);
+        if (!bAlreadyOver)
+        {
+            NumBudgetWarnings++;
+            UE_LOG(LogGame, Warning, TEXT("Memory budget of %s exceeded: %s is %.1f, budget %.1f"), *ExperienceName, *Name, Value, Max);
+        }
+    }
+    else if (OverBudget.Remove(Name) > 0)
+    {
+        UE_LOG(LogGame, Log, TEXT("Memory budget of %s: %s is back under budget (%.1f / %.1f)"), *ExperienceName, *Name, Value, Max);
+    }
+}
+
+void UUR_MemoryBudgetSubsystem::DumpBudget() const
+{
+    if (!IsSampling())
+    {
+        UE_LOG(LogGame, Log, TEXT("No match memory is being sampled"));
+        return;
+    }
+
+    const FUR_MemorySample& Latest = Samples.Last();
+    UE_LOG(LogGame, Log, TEXT("Match memory (%s) at %.0fs, %d samples, %d budget warnings:"), *ExperienceName, Latest.Time, NumSamples, NumBudgetWarnings);
+    UE_LOG(LogGame, Log, TEXT("  Used physical: %.1f MB (budget %.1f), match growth %+.1f MB (budget %.1f)"), Latest.UsedPhysicalMB, Budget.MaxUsedPhysicalMB, GetMatchGrowthMB(), Budget.MaxMatchGrowthMB);
+    UE_LOG(LogGame, Log, TEXT("  UObjects: %d (budget %d), pooled character parts: %d (budget %d)"), Latest.NumObjects, Budget.MaxObjects, Latest.NumPooledCharacterParts, Budget.MaxPooledCharacterParts);
+
+    const UEnum* CategoryEnum = StaticEnum<EUR_ActorRegistryCategory>();
+    for (int32 i = 0; i < Latest.NumRegisteredActors.Num(); i++)
+    {
+        UE_LOG(LogGame, Log, TEXT("  Registered %s actors: %d"), *CategoryEnum->GetNameStringByIndex(i), Latest.NumRegisteredActors[i]);
+    }
+
+    for (int32 i = 0; i < Budget.LLMTags.Num(); i++)
+    {
+        UE_LOG(LogGame, Log, TEXT("  LLM %s: %.1f MB (budget %.1f)"), *Budget.LLMTags[i].Tag.ToString(), Latest.LLMTagMB[i], Budget.LLMTags[i].MaxMB);
+    }
+
+    for (int32 i = 0; i < Budget.ObjectCounts.Num(); i++)
+    {
+        UE_LOG(LogGame, Log, TEXT("  %s objects: %d (budget %d)"), *URMemoryBudget::GetClassName(Budget.ObjectCounts[i]), Latest.ObjectCounts[i], Budget.ObjectCounts[i].MaxCount);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_MemoryBudgetSubsystem::OpenCsv()
+{
+    const UWorld* World = GetWorld();
+    const FString OutputDir = FPaths::ProfilingDir() / TEXT("MemoryBudget");
+    IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+    FString FileName = FString::Printf(TEXT("%s_%s_%s"), *UWorld::RemovePIEPrefix(World->GetMapName()),
+        URMemoryBudget::GetNetModeName(World->GetNetMode()), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+    if (World->WorldType == EWorldType::PIE)
+    {
+        FileName += FString::Printf(TEXT("_%d"), World->GetPackage()->GetPIEInstanceID());
+    }
+
+    const FString FilePath = OutputDir / (FileName + TEXT(".csv"));
+    CsvFile = IFileManager::Get().CreateFileWriter(*FilePath);
+    if (CsvFile == nullptr)
+    {
+        UE_LOG(LogGame, Warning, TEXT("Could not write the match memory samples to %s"), *FilePath);
+        return;
+    }
+
+    FString Header = TEXT("time_s,used_physical_mb,match_growth_mb,uobjects,pooled_character_parts");
+
+    const UEnum* CategoryEnum = StaticEnum<EUR_ActorRegistryCategory>();
+    for (int32 i = 0; i < static_cast<int32>(EUR_ActorRegistryCategory::MAX); i++)
+    {
+        Header += FString::Printf(TEXT(",registered_%s"), *CategoryEnum->GetNameStringByIndex(i).ToLower());
+    }
+    for (const FUR_LLMTagBudget& TagBudget : Budget.LLMTags)
+    {
+        Header += FString::Printf(TEXT(",llm_%s_mb"), *TagBudget.Tag.ToString());
+    }
+    for (const FUR_ObjectCountBudget& ObjectCount : Budget.ObjectCounts)
+    {
+        Header += FString::Printf(TEXT(",objects_%s"), *URMemoryBudget::GetClassName(ObjectCount));
+    }
+
+    CsvFile->Logf(TEXT("%s"), *Header);
+    UE_LOG(LogGame, Log, TEXT("Writing the match memory samples to %s"), *FilePath);
+}
+
+void UUR_MemoryBudgetSubsystem::WriteCsvRow(const FUR_MemorySample& MemorySample)
+{
+    if (CsvFile == nullptr)
+    {
+        return;
+    }
+
+    const double GrowthMB = IsSampling() ? MemorySample.UsedPhysicalMB - Samples[0].UsedPhysicalMB : 0.0;
+    FString Row = FString::Printf(TEXT("%.2f,%.2f,%.2f,%d,%d"), MemorySample.Time, MemorySample.UsedPhysicalMB, GrowthMB,
+        MemorySample.NumObjects, MemorySample.NumPooledCharacterParts);
+
+    for (const int32 NumActors : MemorySample.NumRegisteredActors)
+    {
+        Row += FString::Printf(TEXT(",%d"), NumActors);
+    }
+    // Left empty when LLM is not running
+    for (const double TagMB : MemorySample.LLMTagMB)
+    {
+        Row += TagMB >= 0.0 ? FString::Printf(TEXT(",%.2f"), TagMB) : FString(TEXT(","));
+    }
+    for (const int32 Count : MemorySample.ObjectCounts)
+    {
+        Row += FString::Printf(TEXT(",%d"), Count);
+    }
+
+    CsvFile->Logf(TEXT("%s"), *Row);
+
+    // Long running servers may not shut down cleanly, keep what was sampled so far
+    CsvFile->Flush();
+}
+
+void UUR_MemoryBudgetSubsystem::CloseCsv()
+{
+    if (CsvFile)
+    {
+        // Flush, close and delete
+        delete CsvFile;
+        CsvFile = nullptr;
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "UR_MemoryBudgetTypes.h"
+
+#include "UR_MemoryBudgetSubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AGameStateBase;
+class FArchive;
+class UUR_ExperienceDefinition;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Samples the memory of a running match every OT.Memory.SampleInterval seconds and checks it against the budget of
+ * the experience (UUR_ExperienceDefinition::MemoryBudget).
+ *
+ * A sample holds the used physical memory, the LLM tag totals and per-class object counts listed in the budget, the
+ * number of live UObjects, the occupancy of the character part pool and the actor registry counts.
+ * Each value going over its budget logs a warning, once until it is back under. The first sample of the match is the
+ * baseline its growth is measured from.
+ *
+ * With OT.Memory.WriteCsv, samples are also written as a time series to Saved/Profiling/MemoryBudget, one file per
+ * match and net mode. Memory figures are process wide: a listen server or a PIE session shares them across its worlds.
+ *
+ * OT.Memory.DumpBudget logs the latest sample against the budget.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_MemoryBudgetSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~USubsystem interface
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    //~UWorldSubsystem interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    //~End of UWorldSubsystem interface
+
+    // True once the experience is loaded and samples are being taken
+    bool IsSampling() const
+    {
+        return Samples.Num() > 0;
+    }
+
+    // Takes a sample now, checks it against the budget and records it
+    const FUR_MemorySample& Sample();
+
+    // Takes a sample now and measures the growth of the match from it
+    void ResetBaseline();
+
+    const FUR_MemoryBudget& GetBudget() const
+    {
+        return Budget;
+    }
+
+    // Used physical memory gained since the baseline, as of the latest sample
+    double GetMatchGrowthMB() const;
+
+    // Number of budget warnings logged during the match
+    int32 GetNumBudgetWarnings() const
+    {
+        return NumBudgetWarnings;
+    }
+
+    void DumpBudget() const;
+
+private:
+    void OnGameStateSet(AGameStateBase* GameState);
+
+    void OnExperienceLoaded(const UUR_ExperienceDefinition* Experience);
+
+    FUR_MemorySample TakeSample() const;
+
+    void CheckBudget(const FUR_MemorySample& MemorySample);
+
+    // Logs a warning when Value goes over Max, 0 is no budget
+    void CheckValue(const FString& Name, double Value, double Max);
+
+    void OpenCsv();
+
+    void WriteCsvRow(const FUR_MemorySample& MemorySample);
+
+    void CloseCsv();
+
+    FUR_MemoryBudget Budget;
+
+    FString ExperienceName;
+
+    // Baseline first, then the latest
+    TArray<FUR_MemorySample, TFixedAllocator<2>> Samples;
+
+    int32 NumSamples = 0;
+
+    // Values currently over their budget
+    TSet<FString> OverBudget;
+
+    int32 NumBudgetWarnings = 0;
+
+    FTimerHandle SampleTimerHandle;
+
+    FArchive* CsvFile = nullptr;
+};
@@ -0,0 +1,102 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPtr.h"
+
+#include "UR_MemoryBudgetTypes.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Memory tracked by one LLM tag (Textures, Meshes, Audio, UObject...), only sampled when running with -llm
+USTRUCT(BlueprintType)
+struct FUR_LLMTagBudget
+{
+    GENERATED_BODY()
+
+    // Name of the LLM tag, as listed by 'stat LLMFULL'
+    UPROPERTY(EditAnywhere, Category = Budget)
+    FName Tag;
+
+    // 0 tracks the tag without a budget
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0, Units = "Megabytes"))
+    float MaxMB = 0.f;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Number of live objects of a class, including child classes
+USTRUCT(BlueprintType)
+struct FUR_ObjectCountBudget
+{
+    GENERATED_BODY()
+
+    // Not loaded by the budget, a class that is not loaded has no instances
+    UPROPERTY(EditAnywhere, Category = Budget)
+    TSoftClassPtr<UObject> Class;
+
+    // 0 tracks the class without a budget
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0))
+    int32 MaxCount = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Memory an experience is expected to stay within, checked by UUR_MemoryBudgetSubsystem while a match runs.
+ * 0 means no budget.
+ */
+USTRUCT(BlueprintType)
+struct FUR_MemoryBudget
+{
+    GENERATED_BODY()
+
+    // Physical memory used by the process
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0, Units = "Megabytes"))
+    float MaxUsedPhysicalMB = 0.f;
+
+    // Physical memory the process may gain between the start of the match and any later point of it
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0, Units = "Megabytes"))
+    float MaxMatchGrowthMB = 0.f;
+
+    // Live UObjects of all classes
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0))
+    int32 MaxObjects = 0;
+
+    // Character part actors held by the part pool, waiting to be reused
+    UPROPERTY(EditAnywhere, Category = Budget, meta = (ClampMin = 0))
+    int32 MaxPooledCharacterParts = 0;
+
+    UPROPERTY(EditAnywhere, Category = Budget)
+    TArray<FUR_LLMTagBudget> LLMTags;
+
+    UPROPERTY(EditAnywhere, Category = Budget)
+    TArray<FUR_ObjectCountBudget> ObjectCounts;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// One sample of the memory tracked by UUR_MemoryBudgetSubsystem
+struct FUR_MemorySample
+{
+    // World time of the sample
+    double Time = 0.0;
+
+    double UsedPhysicalMB = 0.0;
+
+    int32 NumObjects = 0;
+
+    int32 NumPooledCharacterParts = 0;
+
+    // Per EUR_ActorRegistryCategory
+    TArray<int32> NumRegisteredActors;
+
+    // Per FUR_MemoryBudget::LLMTags, negative when LLM is not running
+    TArray<double> LLMTagMB;
+
+    // Per FUR_MemoryBudget::ObjectCounts
+    TArray<int32> ObjectCounts;
+};
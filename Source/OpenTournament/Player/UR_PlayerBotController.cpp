@@ -10,6 +10,8 @@
 #include "GameFramework/PlayerState.h"
 #include "Perception/AIPerceptionComponent.h"
 
+#include "AI/UR_BotSensingSubsystem.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 #include "UR_LogChannels.h"
 #include "GameModes/UR_GameMode.h"
 
@@ -29,6 +31,44 @@ AUR_PlayerBotController::AUR_PlayerBotController(const FObjectInitializer& Objec
 	bStopAILogicOnUnposses = false;
 }
 
+void AUR_PlayerBotController::PostInitializeComponents()
+{
+	// Before Super, which initializes the player state
+	if (!bRandomSeeded)
+	{
+		SetRandomSeed(FMath::Rand());
+	}
+
+	Super::PostInitializeComponents();
+}
+
+void AUR_PlayerBotController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Controller);
+
+	if (HasAuthority())
+	{
+		if (UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+		{
+			BotSensing->RegisterBot(this);
+		}
+	}
+}
+
+void AUR_PlayerBotController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Controller);
+
+	if (UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+	{
+		BotSensing->UnregisterBot(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AUR_PlayerBotController::OnPlayerStateChangedTeam(UObject* TeamAgent, int32 OldTeam, int32 NewTeam)
 {
 	ConditionalBroadcastTeamChanged(this, IntegerToGenericTeamId(OldTeam), IntegerToGenericTeamId(NewTeam));
@@ -144,6 +184,18 @@ ETeamAttitude::Type AUR_PlayerBotController::GetTeamAttitudeTowards(const AActor
 {
 	if (const APawn* OtherPawn = Cast<APawn>(&Other)) {
 
+		// Teams snapshot by the sensing round, perception asks for every pawn it senses
+		if (const UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+		{
+			int32 TeamId = INDEX_NONE;
+			int32 OtherTeamId = INDEX_NONE;
+			if (BotSensing->GetCachedTeamId(GetPawn(), TeamId) && BotSensing->GetCachedTeamId(OtherPawn, OtherTeamId))
+			{
+				return TeamId != OtherTeamId ? ETeamAttitude::Hostile : ETeamAttitude::Friendly;
+			}
+		}
+
+		// Pawns the round has not seen yet
 		if (const IUR_TeamAgentInterface* TeamAgent = Cast<IUR_TeamAgentInterface>(OtherPawn->GetController()))
 		{
 			FGenericTeamId OtherTeamID = TeamAgent->GetGenericTeamId();
@@ -171,6 +223,38 @@ void AUR_PlayerBotController::UpdateTeamAttitude(UAIPerceptionComponent* AIPerce
 	}
 }
 
+void AUR_PlayerBotController::SetRandomSeed(int32 Seed)
+{
+	RandomStream.Initialize(Seed);
+	bRandomSeeded = true;
+}
+
+float AUR_PlayerBotController::GetRandomFloatInRange(float Min, float Max)
+{
+	return RandomStream.FRandRange(Min, Max);
+}
+
+int32 AUR_PlayerBotController::GetRandomIntegerInRange(int32 Min, int32 Max)
+{
+	return RandomStream.RandRange(Min, Max);
+}
+
+TArray<APawn*> AUR_PlayerBotController::GetSensedTargets() const
+{
+	TArray<APawn*> Result;
+	if (const UUR_BotSensingSubsystem* BotSensing = UWorld::GetSubsystem<UUR_BotSensingSubsystem>(GetWorld()))
+	{
+		for (const FUR_BotTargetCandidate& Candidate : BotSensing->GetTargetCandidates(this))
+		{
+			if (APawn* TargetPawn = Candidate.Pawn.Get())
+			{
+				Result.Add(TargetPawn);
+			}
+		}
+	}
+	return Result;
+}
+
 void AUR_PlayerBotController::OnUnPossess()
 {
 	// Make sure the pawn that is being unpossessed doesn't remain our ASC's avatar actor
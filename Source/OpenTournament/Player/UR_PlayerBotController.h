@@ -18,6 +18,7 @@ namespace ETeamAttitude
 
 struct FGenericTeamId;
 
+class APawn;
 class APlayerState;
 class UAIPerceptionComponent;
 class UObject;
@@ -56,6 +57,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "OT AI Player Controller")
     void UpdateTeamAttitude(UAIPerceptionComponent* AIPerception);
 
+    // Seeds every random decision of this bot, see UUR_BotCreationComponent.
+    // Bots spawned without a seed get a random one in PostInitializeComponents.
+    void SetRandomSeed(int32 Seed);
+
+    // Random numbers from this bot's stream, for behavior trees and blueprints that need to stay reproducible
+    UFUNCTION(BlueprintCallable, Category = "OT AI Player Controller")
+    float GetRandomFloatInRange(float Min, float Max);
+
+    UFUNCTION(BlueprintCallable, Category = "OT AI Player Controller")
+    int32 GetRandomIntegerInRange(int32 Min, int32 Max);
+
+    // Visible hostile pawns from the shared bot sensing, closest first
+    UFUNCTION(BlueprintCallable, Category = "OT AI Player Controller")
+    TArray<APawn*> GetSensedTargets() const;
+
     virtual void OnUnPossess() override;
 
 private:
@@ -70,6 +86,12 @@ private:
     void BroadcastOnPlayerStateChanged();
 
 protected:
+    //~AActor interface
+    virtual void PostInitializeComponents() override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    //~End of AActor interface
+
     //~AController interface
     virtual void InitPlayerState() override;
 
@@ -83,6 +105,10 @@ private:
     UPROPERTY()
     FOnGameTeamIndexChangedDelegate OnTeamChangedDelegate;
 
+    FRandomStream RandomStream;
+
+    bool bRandomSeeded = false;
+
     UPROPERTY()
     TObjectPtr<APlayerState> LastSeenPlayerState;
 };
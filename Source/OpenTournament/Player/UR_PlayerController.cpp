@@ -4,7 +4,6 @@
 
 #include "UR_PlayerController.h"
 
-#include <EngineUtils.h>
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "UR_AbilitySystemComponent.h"
@@ -25,6 +24,7 @@
 #include "UR_PCInputDodgeComponent.h"
 #include "UR_PlayerState.h"
 #include "UR_Widget_ScoreboardBase.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_PlayerController)
 
@@ -221,6 +221,18 @@ void AUR_PlayerController::ClientMessage_Implementation(const FString& S, FName
     }
 }
 
+void AUR_PlayerController::ClientReceiveDamageEvents_Implementation(const TArray<FUR_CompactDamageEvent>& DamageEvents)
+{
+    for (const FUR_CompactDamageEvent& DamageEvent : DamageEvents)
+    {
+        // Victim can be missing if it is not relevant to us, nothing to notify then
+        if (AUR_Character* Victim = DamageEvent.Victim)
+        {
+            Victim->BroadcastDamageEvent(DamageEvent.ToReplicatedDamageEvent());
+        }
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 void AUR_PlayerController::ShowScoreboard()
@@ -394,12 +406,12 @@ void AUR_PlayerController::ServerCheatAll_Implementation(const FString& Msg)
     if (CheatManager)
     {
         UE_LOG(LogGame, Warning, TEXT("ServerCheatAll: %s"), *Msg);
-        for (TActorIterator<AUR_PlayerController> It(GetWorld()); It; ++It)
+        if (const UUR_ActorRegistrySubsystem* ActorRegistry = UWorld::GetSubsystem<UUR_ActorRegistrySubsystem>(GetWorld()))
         {
-            if (AUR_PlayerController* GamePC = (*It))
+            ActorRegistry->ForEachActor<AUR_PlayerController>(EUR_ActorRegistryCategory::Controller, [&Msg](AUR_PlayerController* GamePC)
             {
                 GamePC->ClientMessage(GamePC->ConsoleCommand(Msg));
-            }
+            });
         }
     }
 #endif // #if USING_CHEAT_MANAGER
@@ -6,6 +6,7 @@
 
 #include "UR_BasePlayerController.h"
 
+#include "Character/UR_CompactDamageEvent.h"
 #include "Interfaces/UR_TeamInterface.h"
 
 #include "UR_PlayerController.generated.h"
@@ -193,6 +194,12 @@ public:
     UPROPERTY(BlueprintAssignable)
     FReceiveSystemMessageSignature OnReceiveSystemMessage;
 
+    /**
+    * Grouped damage events this player is involved in, as victim, instigator or spectator.
+    */
+    UFUNCTION(Client, Unreliable)
+    void ClientReceiveDamageEvents(const TArray<FUR_CompactDamageEvent>& DamageEvents);
+
     /**
     * Blueprint hook for ClientMessage.
     */
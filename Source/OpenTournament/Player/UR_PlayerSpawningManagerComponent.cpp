@@ -4,10 +4,13 @@
 
 #include "UR_PlayerSpawningManagerComponent.h"
 
+#include <GameFramework/GameModeBase.h>
 #include <GameFramework/PlayerState.h>
 #include <EngineUtils.h>
+#include <Kismet/GameplayStatics.h>
 
 #include "UR_PlayerStart.h"
+#include "GameModes/UR_GameMode.h"
 
 #if WITH_EDITOR
 #include <Engine/PlayerStartPIE.h>
@@ -41,6 +44,14 @@ void UUR_PlayerSpawningManagerComponent::InitializeComponent()
     FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAdded);
 
     UWorld* World = GetWorld();
+
+    int32 Seed = 0;
+    if (const AUR_GameMode* GameMode = World->GetAuthGameMode<AUR_GameMode>())
+    {
+        Seed = GameMode->GetMatchSeed();
+    }
+    StartPointRandom.Initialize(HashCombine(GetTypeHash(Seed), GetTypeHash(TEXT("PlayerStarts"))));
+
     World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::HandleOnActorSpawned));
 
     for (TActorIterator<AUR_PlayerStart> It(World); It; ++It)
@@ -89,12 +100,12 @@ APlayerStart* UUR_PlayerSpawningManagerComponent::GetFirstRandomUnoccupiedPlayer
 
         if (UnOccupiedStartPoints.Num() > 0)
         {
-            return UnOccupiedStartPoints[FMath::RandRange(0, UnOccupiedStartPoints.Num() - 1)];
+            return UnOccupiedStartPoints[StartPointRandom.RandRange(0, UnOccupiedStartPoints.Num() - 1)];
         }
 
         if (OccupiedStartPoints.Num() > 0)
         {
-            return OccupiedStartPoints[FMath::RandRange(0, OccupiedStartPoints.Num() - 1)];
+            return OccupiedStartPoints[StartPointRandom.RandRange(0, OccupiedStartPoints.Num() - 1)];
         }
     }
 
@@ -147,7 +158,7 @@ AActor* UUR_PlayerSpawningManagerComponent::ChoosePlayerStart(AController* Playe
             {
                 if (!StarterPoints.IsEmpty())
                 {
-                    return StarterPoints[FMath::RandRange(0, StarterPoints.Num() - 1)];
+                    return StarterPoints[StartPointRandom.RandRange(0, StarterPoints.Num() - 1)];
                 }
 
                 return nullptr;
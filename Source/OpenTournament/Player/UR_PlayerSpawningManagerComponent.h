@@ -60,6 +60,9 @@ private:
     UPROPERTY(Transient)
     TArray<TWeakObjectPtr<AUR_PlayerStart>> CachedPlayerStarts;
 
+    // Seeded from the game mode's match seed, so bot matches spawn the same way every run
+    mutable FRandomStream StartPointRandom;
+
 private:
     void OnLevelAdded(ULevel* InLevel, UWorld* InWorld);
 
@@ -0,0 +1,31 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_DemoNetDriver.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_DemoNetDriver)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_DemoNetDriver::TickFlush(float DeltaSeconds)
+{
+    if (!IsRecording())
+    {
+        Super::TickFlush(DeltaSeconds);
+        return;
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    Super::TickFlush(DeltaSeconds);
+
+    const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+    RecordStats.NumFrames++;
+    RecordStats.TotalMs += FrameMs;
+    RecordStats.MaxMs = FMath::Max(RecordStats.MaxMs, FrameMs);
+    if (RecordBudgetMs > 0.f && FrameMs > RecordBudgetMs)
+    {
+        RecordStats.NumFramesOverBudget++;
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Engine/DemoNetDriver.h>
+
+#include "UR_DemoNetDriver.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Recording cost of a replay, measured around each net flush of the demo driver (frame recording and checkpoints).
+ */
+struct FUR_ReplayRecordStats
+{
+    int32 NumFrames = 0;
+    int32 NumFramesOverBudget = 0;
+    double TotalMs = 0.0;
+    double MaxMs = 0.0;
+
+    double GetAverageMs() const
+    {
+        return NumFrames > 0 ? TotalMs / NumFrames : 0.0;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Demo net driver that keeps track of what recording costs the game thread each frame.
+ * Registered as the DemoNetDriver definition in DefaultEngine.ini.
+ */
+UCLASS(Transient)
+class OPENTOURNAMENT_API UUR_DemoNetDriver : public UDemoNetDriver
+{
+    GENERATED_BODY()
+
+public:
+    //~UNetDriver interface
+    virtual void TickFlush(float DeltaSeconds) override;
+    //~End of UNetDriver interface
+
+    const FUR_ReplayRecordStats& GetRecordStats() const
+    {
+        return RecordStats;
+    }
+
+    void ResetRecordStats()
+    {
+        RecordStats = FUR_ReplayRecordStats();
+    }
+
+    // Frames taking longer than this are counted as over budget
+    float RecordBudgetMs = 0.f;
+
+private:
+    FUR_ReplayRecordStats RecordStats;
+};
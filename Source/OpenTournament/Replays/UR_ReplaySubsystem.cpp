@@ -0,0 +1,223 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_ReplaySubsystem.h"
+
+#include <Engine/GameInstance.h>
+#include <Engine/World.h>
+#include <Misc/DateTime.h>
+#include <Misc/NetworkVersion.h>
+#include <NativeGameplayTags.h>
+
+#include "UR_DemoNetDriver.h"
+#include "UR_LogChannels.h"
+#include "Settings/UR_SettingsLocal.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_ReplaySubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Platform_Trait_ReplaySupport, "Platform.Trait.ReplaySupport");
+
+namespace OTConsoleVariables
+{
+    static bool bRecordDedicatedServer = false;
+    static FAutoConsoleVariableRef CVarRecordDedicatedServer
+    (
+        TEXT("OT.Replay.RecordDedicatedServer"),
+        bRecordDedicatedServer,
+        TEXT("Dedicated servers record a replay of every match, not only of matches started with ?RecordReplay."),
+        ECVF_Default
+    );
+
+    static float ReplayRecordHz = 10.f;
+    static FAutoConsoleVariableRef CVarReplayRecordHz
+    (
+        TEXT("OT.Replay.RecordHz"),
+        ReplayRecordHz,
+        TEXT("Frames per second recorded in replays, applied when a recording starts."),
+        ECVF_Default
+    );
+
+    static float ReplayMaxRecordTimeMS = 2.f;
+    static FAutoConsoleVariableRef CVarReplayMaxRecordTimeMS
+    (
+        TEXT("OT.Replay.MaxRecordTimeMS"),
+        ReplayMaxRecordTimeMS,
+        TEXT("Time a recorded frame may spend replicating actors before the rest are deferred to the next frame, applied when a recording starts."),
+        ECVF_Default
+    );
+
+    static int32 NumServerReplaysToKeep = 10;
+    static FAutoConsoleVariableRef CVarNumServerReplaysToKeep
+    (
+        TEXT("OT.Replay.NumServerReplaysToKeep"),
+        NumServerReplaysToKeep,
+        TEXT("Number of replays kept on disk by dedicated servers, older ones are deleted when a new recording starts. 0 keeps everything."),
+        ECVF_Default
+    );
+
+    static FAutoConsoleCommandWithWorld CVarDumpReplayRecordStats
+    (
+        TEXT("OT.Replay.DumpRecordStats"),
+        TEXT("Shows what recording the current replay costs per frame."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (const UUR_ReplaySubsystem* ReplaySubsystem = UGameInstance::GetSubsystem<UUR_ReplaySubsystem>(World ? World->GetGameInstance() : nullptr))
+            {
+                ReplaySubsystem->DumpRecordStats();
+            }
+        })
+    );
+}
+
+namespace URReplays
+{
+    static const TCHAR* LocalFileStreamer = TEXT("LocalFileNetworkReplayStreaming");
+
+    static void SetEngineConsoleVariable(const TCHAR* Name, float Value)
+    {
+        if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name))
+        {
+            CVar->Set(Value, ECVF_SetByCode);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+FGameplayTag UUR_ReplaySubsystem::GetPlatformSupportTraitTag()
+{
+    return TAG_Platform_Trait_ReplaySupport.GetTag();
+}
+
+bool UUR_ReplaySubsystem::ShouldRecordDedicatedServerMatches()
+{
+    return OTConsoleVariables::bRecordDedicatedServer;
+}
+
+bool UUR_ReplaySubsystem::RecordMatch()
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    UWorld* World = GameInstance->GetWorld();
+    if (World == nullptr || World->GetNetMode() == NM_Client || IsRecording())
+    {
+        return false;
+    }
+
+    URReplays::SetEngineConsoleVariable(TEXT("demo.RecordHz"), OTConsoleVariables::ReplayRecordHz);
+    URReplays::SetEngineConsoleVariable(TEXT("demo.MaxDesiredRecordTimeMS"), OTConsoleVariables::ReplayMaxRecordTimeMS);
+
+    const bool bDedicatedServer = World->GetNetMode() == NM_DedicatedServer;
+    CleanupLocalReplays(bDedicatedServer ? OTConsoleVariables::NumServerReplaysToKeep : UUR_SettingsLocal::Get()->GetNumberOfReplaysToKeep());
+
+    RecordingName = FString::Printf(TEXT("%s_%s%s"), *UWorld::RemovePIEPrefix(World->GetMapName()),
+        *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")), bDedicatedServer ? TEXT("_Server") : TEXT(""));
+
+    GameInstance->StartRecordingReplay(RecordingName, RecordingName, { FString::Printf(TEXT("ReplayStreamerOverride=%s"), URReplays::LocalFileStreamer) });
+
+    if (!IsRecording())
+    {
+        UE_LOG(LogGame, Warning, TEXT("Could not start recording replay %s"), *RecordingName);
+        return false;
+    }
+
+    if (UUR_DemoNetDriver* DemoNetDriver = GetDemoNetDriver())
+    {
+        DemoNetDriver->RecordBudgetMs = OTConsoleVariables::ReplayMaxRecordTimeMS;
+    }
+
+    UE_LOG(LogGame, Log, TEXT("Recording replay %s (%.0f Hz, %.2f ms per frame)"), *RecordingName, OTConsoleVariables::ReplayRecordHz, OTConsoleVariables::ReplayMaxRecordTimeMS);
+    return true;
+}
+
+void UUR_ReplaySubsystem::StopRecording()
+{
+    if (IsRecording())
+    {
+        DumpRecordStats();
+        GetGameInstance()->StopRecordingReplay();
+    }
+}
+
+bool UUR_ReplaySubsystem::IsRecording() const
+{
+    const UWorld* World = GetGameInstance()->GetWorld();
+    const UDemoNetDriver* DemoNetDriver = World ? World->GetDemoNetDriver() : nullptr;
+    return DemoNetDriver && DemoNetDriver->IsRecording();
+}
+
+bool UUR_ReplaySubsystem::PlayReplay(const FString& ReplayName)
+{
+    return GetGameInstance()->PlayReplay(ReplayName, nullptr, { FString::Printf(TEXT("ReplayStreamerOverride=%s"), URReplays::LocalFileStreamer) });
+}
+
+void UUR_ReplaySubsystem::CleanupLocalReplays(int32 NumToKeep)
+{
+    if (NumToKeep <= 0)
+    {
+        return;
+    }
+
+    CleanupStreamer = FNetworkReplayStreaming::Get().GetFactory(URReplays::LocalFileStreamer).CreateReplayStreamer();
+    if (CleanupStreamer.IsValid())
+    {
+        // Replays of older builds count towards the limit as well
+        FNetworkReplayVersion Version = FNetworkVersion::GetReplayVersion();
+        Version.NetworkVersion = 0;
+        Version.Changelist = 0;
+
+        CleanupStreamer->EnumerateStreams(Version, INDEX_NONE, FString(), TArray<FString>(),
+            FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsForCleanup, NumToKeep));
+    }
+}
+
+void UUR_ReplaySubsystem::OnEnumerateStreamsForCleanup(const FEnumerateStreamsResult& Result, int32 NumToKeep)
+{
+    if (!CleanupStreamer.IsValid() || !Result.WasSuccessful())
+    {
+        return;
+    }
+
+    TArray<FNetworkReplayStreamInfo> FinishedStreams;
+    for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+    {
+        if (!StreamInfo.bIsLive && !StreamInfo.bShouldKeep)
+        {
+            FinishedStreams.Add(StreamInfo);
+        }
+    }
+
+    // Most recent first
+    FinishedStreams.Sort([](const FNetworkReplayStreamInfo& A, const FNetworkReplayStreamInfo& B)
+    {
+        return B.Timestamp < A.Timestamp;
+    });
+
+    for (int32 i = NumToKeep; i < FinishedStreams.Num(); i++)
+    {
+        UE_LOG(LogGame, Log, TEXT("Deleting old replay %s"), *FinishedStreams[i].Name);
+        CleanupStreamer->DeleteFinishedStream(FinishedStreams[i].Name, INDEX_NONE, FDeleteFinishedStreamCallback());
+    }
+}
+
+UUR_DemoNetDriver* UUR_ReplaySubsystem::GetDemoNetDriver() const
+{
+    const UWorld* World = GetGameInstance()->GetWorld();
+    return World ? Cast<UUR_DemoNetDriver>(World->GetDemoNetDriver()) : nullptr;
+}
+
+void UUR_ReplaySubsystem::DumpRecordStats() const
+{
+    const UUR_DemoNetDriver* DemoNetDriver = GetDemoNetDriver();
+    if (DemoNetDriver == nullptr || !DemoNetDriver->IsRecording())
+    {
+        UE_LOG(LogGame, Log, TEXT("No replay is being recorded"));
+        return;
+    }
+
+    const FUR_ReplayRecordStats& Stats = DemoNetDriver->GetRecordStats();
+    UE_LOG(LogGame, Log, TEXT("Replay %s: %d frames, recording %.3f ms avg, %.3f ms max, %d frames over the %.2f ms budget"),
+        *RecordingName, Stats.NumFrames, Stats.GetAverageMs(), Stats.MaxMs, Stats.NumFramesOverBudget, DemoNetDriver->RecordBudgetMs);
+}
@@ -0,0 +1,76 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/GameInstanceSubsystem.h>
+#include <NetworkReplayStreaming.h>
+
+#include "UR_ReplaySubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class UUR_DemoNetDriver;
+struct FGameplayTag;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Records matches to local replay files and plays them back.
+ *
+ * Servers record a match when it is started with the ?RecordReplay option, dedicated servers also record every match
+ * when OT.Replay.RecordDedicatedServer is set. Replays go through the local file streamer (Saved/Demos).
+ *
+ * Recording is bounded: frames are recorded at OT.Replay.RecordHz, each recorded frame may spend up to
+ * OT.Replay.MaxRecordTimeMS before the remaining actors are deferred to the next one, and only the most recent
+ * replays are kept on disk (OT.Replay.NumServerReplaysToKeep on servers, the user setting otherwise).
+ *
+ * OT.Replay.DumpRecordStats reports the recording cost per frame of the current replay.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_ReplaySubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static FGameplayTag GetPlatformSupportTraitTag();
+
+    // True if dedicated servers should record every match
+    static bool ShouldRecordDedicatedServerMatches();
+
+    // Starts recording the current match, returns false if a replay is already being recorded or recording failed to start
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    bool RecordMatch();
+
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    void StopRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    bool IsRecording() const;
+
+    // Name of the replay being recorded, or of the last recorded one
+    UFUNCTION(BlueprintPure, Category = "Replays")
+    const FString& GetRecordingName() const
+    {
+        return RecordingName;
+    }
+
+    // Plays a local replay, the current world travels to the replay
+    UFUNCTION(BlueprintCallable, Category = "Replays")
+    bool PlayReplay(const FString& ReplayName);
+
+    // Deletes local replays beyond the NumToKeep most recent ones, 0 keeps everything
+    void CleanupLocalReplays(int32 NumToKeep);
+
+    UUR_DemoNetDriver* GetDemoNetDriver() const;
+
+    void DumpRecordStats() const;
+
+private:
+    void OnEnumerateStreamsForCleanup(const FEnumerateStreamsResult& Result, int32 NumToKeep);
+
+    FString RecordingName;
+
+    TSharedPtr<INetworkReplayStreamer> CleanupStreamer;
+};
@@ -11,7 +11,7 @@
 #include "UR_SettingsLocal.h"
 #include "GameSettingValueDiscreteDynamic.h"
 #include "Player/UR_LocalPlayer.h"
-//#include "Replays/UR_ReplaySubsystem.h" // @! TODO : Replay
+#include "Replays/UR_ReplaySubsystem.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,7 +71,7 @@ UGameSettingCollection* UUR_GameSettingRegistry::InitializeGameplaySettings(UUR_
             Setting->SetDefaultValue(GetDefault<UUR_SettingsLocal>()->ShouldAutoRecordReplays());
 
             Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
-            //Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(UUR_ReplaySubsystem::GetPlatformSupportTraitTag(), TEXT("Platform does not support saving replays")));
+            Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(UUR_ReplaySubsystem::GetPlatformSupportTraitTag(), TEXT("Platform does not support saving replays")));
 
             ReplaySubsection->AddSetting(Setting);
         }
@@ -93,7 +93,7 @@ UGameSettingCollection* UUR_GameSettingRegistry::InitializeGameplaySettings(UUR_
             }
 
             Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
-            // Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(UUR_ReplaySubsystem::GetPlatformSupportTraitTag(), TEXT("Platform does not support saving replays")));
+            Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(UUR_ReplaySubsystem::GetPlatformSupportTraitTag(), TEXT("Platform does not support saving replays")));
 
             ReplaySubsection->AddSetting(Setting);
         }
@@ -27,3 +27,47 @@ TSharedPtr<FStreamableHandle> FGameAssetManagerStartupJob::DoJob() const
 
     return Handle;
 }
+
+void FGameAssetManagerStartupJob::StartJob()
+{
+    check(State == EGameAssetManagerStartupJobState::Pending);
+
+    StartTime = FPlatformTime::Seconds();
+    State = EGameAssetManagerStartupJobState::Running;
+    UE_LOG(LogGame, Display, TEXT("Startup job \"%s\" starting"), *JobName);
+
+    JobFunc(*this, Handle);
+    DispatchedTime = FPlatformTime::Seconds();
+
+    if (Handle.IsValid() && !Handle->HasLoadCompleted())
+    {
+        Handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateRaw(this, &FGameAssetManagerStartupJob::UpdateSubstepProgressFromStreamable));
+    }
+}
+
+bool FGameAssetManagerStartupJob::IsWorkComplete() const
+{
+    if (State != EGameAssetManagerStartupJobState::Running)
+    {
+        return State == EGameAssetManagerStartupJobState::Complete;
+    }
+
+    return !Handle.IsValid() || Handle->HasLoadCompletedOrStalled() || Handle->WasCanceled();
+}
+
+void FGameAssetManagerStartupJob::FinishJob()
+{
+    check(State == EGameAssetManagerStartupJobState::Running);
+
+    if (Handle.IsValid())
+    {
+        Handle->BindUpdateDelegate(FStreamableUpdateDelegate());
+    }
+
+    State = EGameAssetManagerStartupJobState::Complete;
+    EndTime = FPlatformTime::Seconds();
+    UpdateSubstepProgress(1.0f);
+
+    UE_LOG(LogGame, Display, TEXT("Startup job \"%s\" took %.2f seconds to complete (queued %.2f, run %.2f, async wait %.2f)"),
+        *JobName, GetTotalSeconds(), GetQueuedSeconds(), GetRunSeconds(), GetWaitSeconds());
+}
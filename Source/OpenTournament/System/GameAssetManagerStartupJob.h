@@ -10,6 +10,15 @@
 
 DECLARE_DELEGATE_OneParam(FGameAssetManagerStartupJobSubstepProgress, float /*NewProgress*/);
 
+enum class EGameAssetManagerStartupJobState : uint8
+{
+    // Waiting on dependencies
+    Pending,
+    // Job function has run, waiting on its streamable handle
+    Running,
+    Complete
+};
+
 /** Handles reporting progress from streamable handles */
 struct FGameAssetManagerStartupJob
 {
@@ -19,6 +28,9 @@ struct FGameAssetManagerStartupJob
     float JobWeight;
     mutable double LastUpdate = 0;
 
+    // Indices (into the owning startup job list) of jobs that must complete before this one may start
+    TArray<int32> Dependencies;
+
     /** Simple job that is all synchronous */
     FGameAssetManagerStartupJob(const FString& InJobName, const TFunction<void(const FGameAssetManagerStartupJob&, TSharedPtr<FStreamableHandle>&)>& InJobFunc, float InJobWeight) :
         JobFunc(InJobFunc)
@@ -27,11 +39,39 @@ struct FGameAssetManagerStartupJob
     {
     }
 
+    /** Job that only starts once all of InDependencies have completed */
+    FGameAssetManagerStartupJob(const FString& InJobName, const TFunction<void(const FGameAssetManagerStartupJob&, TSharedPtr<FStreamableHandle>&)>& InJobFunc, float InJobWeight, const TArray<int32>& InDependencies) :
+        JobFunc(InJobFunc)
+        , JobName(InJobName)
+        , JobWeight(InJobWeight)
+        , Dependencies(InDependencies)
+    {
+    }
+
     /** Perform actual loading, will return a handle if it created one */
     TSharedPtr<FStreamableHandle> DoJob() const;
 
+    /** Run the job function without waiting on the resulting load */
+    void StartJob();
+
+    /** True once the job function has returned and its streamable handle (if any) has finished loading */
+    bool IsWorkComplete() const;
+
+    /** Releases the progress binding and records the completion time */
+    void FinishJob();
+
+    EGameAssetManagerStartupJobState GetState() const { return State; }
+    float GetProgress() const { return Progress; }
+
+    // Seconds spent waiting on dependencies, running the job function and waiting on async work
+    double GetQueuedSeconds() const { return StartTime - QueuedTime; }
+    double GetRunSeconds() const { return DispatchedTime - StartTime; }
+    double GetWaitSeconds() const { return EndTime - DispatchedTime; }
+    double GetTotalSeconds() const { return EndTime - StartTime; }
+
     void UpdateSubstepProgress(float NewProgress) const
     {
+        Progress = NewProgress;
         SubstepProgressDelegate.ExecuteIfBound(NewProgress);
     }
 
@@ -41,11 +81,22 @@ struct FGameAssetManagerStartupJob
         {
             // StreamableHandle::GetProgress traverses() a large graph and is quite expensive
             double Now = FPlatformTime::Seconds();
-            if (LastUpdate - Now > 1.0 / 60)
+            if (Now - LastUpdate > 1.0 / 60)
             {
-                SubstepProgressDelegate.Execute(StreamableHandle->GetProgress());
+                UpdateSubstepProgress(StreamableHandle->GetProgress());
                 LastUpdate = Now;
             }
         }
     }
+
+private:
+    TSharedPtr<FStreamableHandle> Handle;
+
+    EGameAssetManagerStartupJobState State = EGameAssetManagerStartupJobState::Pending;
+    mutable float Progress = 0.0f;
+
+    double QueuedTime = FPlatformTime::Seconds();
+    double StartTime = 0.0;
+    double DispatchedTime = 0.0;
+    double EndTime = 0.0;
 };
@@ -0,0 +1,78 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_ActorRegistrySubsystem.h"
+
+#include <Engine/World.h>
+#include <GameFramework/Actor.h>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_ActorRegistrySubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_ActorRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Lists.SetNum(static_cast<int32>(EUR_ActorRegistryCategory::MAX));
+}
+
+void UUR_ActorRegistrySubsystem::Deinitialize()
+{
+    Lists.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UUR_ActorRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_ActorRegistrySubsystem::RegisterActor(AActor* Actor, EUR_ActorRegistryCategory Category)
+{
+    UUR_ActorRegistrySubsystem* Registry = UWorld::GetSubsystem<UUR_ActorRegistrySubsystem>(Actor ? Actor->GetWorld() : nullptr);
+    if (Registry == nullptr || !Registry->Lists.IsValidIndex(static_cast<int32>(Category)))
+    {
+        return;
+    }
+
+    FUR_RegisteredActorList& List = Registry->Lists[static_cast<int32>(Category)];
+    if (!List.IndexByActor.Contains(Actor))
+    {
+        List.IndexByActor.Add(Actor, List.Actors.Add(Actor));
+    }
+}
+
+void UUR_ActorRegistrySubsystem::UnregisterActor(AActor* Actor, EUR_ActorRegistryCategory Category)
+{
+    UUR_ActorRegistrySubsystem* Registry = UWorld::GetSubsystem<UUR_ActorRegistrySubsystem>(Actor ? Actor->GetWorld() : nullptr);
+    if (Registry == nullptr || !Registry->Lists.IsValidIndex(static_cast<int32>(Category)))
+    {
+        return;
+    }
+
+    FUR_RegisteredActorList& List = Registry->Lists[static_cast<int32>(Category)];
+    int32 Index;
+    if (List.IndexByActor.RemoveAndCopyValue(Actor, Index))
+    {
+        List.Actors.RemoveAtSwap(Index, EAllowShrinking::No);
+        if (List.Actors.IsValidIndex(Index))
+        {
+            List.IndexByActor.Add(List.Actors[Index].Get(), Index);
+        }
+    }
+}
+
+TArray<AActor*> UUR_ActorRegistrySubsystem::K2_GetActors(EUR_ActorRegistryCategory Category) const
+{
+    TArray<AActor*> Result;
+    for (AActor* Actor : GetActors(Category))
+    {
+        Result.Add(Actor);
+    }
+    return Result;
+}
@@ -0,0 +1,101 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "UR_ActorRegistrySubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+UENUM(BlueprintType)
+enum class EUR_ActorRegistryCategory : uint8
+{
+    Pawn,
+    Controller,
+    Projectile,
+    Pickup,
+    // Map triggers: trigger zones, jump pads, teleporters and lifts
+    Trigger,
+    MAX UMETA(Hidden)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+USTRUCT()
+struct FUR_RegisteredActorList
+{
+    GENERATED_BODY()
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<AActor>> Actors;
+
+    TMap<TObjectKey<AActor>, int32> IndexByActor;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Lists of the gameplay actors of a world by category, for mode-wide sweeps that would otherwise iterate every actor.
+ *
+ * Gameplay classes register on BeginPlay and unregister on EndPlay, both are constant time.
+ * Lists are unordered: unregistering moves the last actor of the list into the freed slot.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_ActorRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    //~UWorldSubsystem interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    //~End of UWorldSubsystem interface
+
+    static void RegisterActor(AActor* Actor, EUR_ActorRegistryCategory Category);
+
+    static void UnregisterActor(AActor* Actor, EUR_ActorRegistryCategory Category);
+
+    // Registered actors of Category. Must not be held while actors of Category may spawn or be destroyed, use ForEachActor then.
+    TConstArrayView<TObjectPtr<AActor>> GetActors(EUR_ActorRegistryCategory Category) const
+    {
+        const int32 Index = static_cast<int32>(Category);
+        return Lists.IsValidIndex(Index) ? TConstArrayView<TObjectPtr<AActor>>(Lists[Index].Actors) : TConstArrayView<TObjectPtr<AActor>>();
+    }
+
+    UFUNCTION(BlueprintCallable, Category = "Actor Registry", meta = (DisplayName = "Get Registered Actors"))
+    TArray<AActor*> K2_GetActors(EUR_ActorRegistryCategory Category) const;
+
+    // Calls Func for each registered actor of Category that is a T, actors may spawn or be destroyed during the sweep
+    template<typename T>
+    void ForEachActor(EUR_ActorRegistryCategory Category, TFunctionRef<void(T*)> Func) const
+    {
+        TArray<AActor*, TInlineAllocator<64>> Snapshot;
+        for (AActor* Actor : GetActors(Category))
+        {
+            Snapshot.Add(Actor);
+        }
+
+        for (AActor* Actor : Snapshot)
+        {
+            if (T* TypedActor = Cast<T>(Actor); IsValid(TypedActor))
+            {
+                Func(TypedActor);
+            }
+        }
+    }
+
+private:
+    UPROPERTY(Transient)
+    TArray<FUR_RegisteredActorList> Lists;
+};
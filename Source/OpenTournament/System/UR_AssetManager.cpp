@@ -8,6 +8,7 @@
 #include "Misc/App.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Stats/StatsMisc.h"
+#include "UObject/UObjectGlobals.h"
 
 #include "UR_GameData.h"
 #include "UR_LogChannels.h"
@@ -30,8 +31,24 @@ static FAutoConsoleCommand CVarDumpLoadedAssets
 
 //////////////////////////////////////////////////////////////////////
 
+// Each macro evaluates to the index of the added job, which later jobs can list as a dependency
 #define STARTUP_JOB_WEIGHTED(JobFunc, JobWeight) StartupJobs.Add(FGameAssetManagerStartupJob(#JobFunc, [this](const FGameAssetManagerStartupJob& StartupJob, TSharedPtr<FStreamableHandle>& LoadHandle){JobFunc;}, JobWeight))
 #define STARTUP_JOB(JobFunc) STARTUP_JOB_WEIGHTED(JobFunc, 1.f)
+#define STARTUP_JOB_AFTER(JobFunc, JobWeight, ...) StartupJobs.Add(FGameAssetManagerStartupJob(#JobFunc, [this](const FGameAssetManagerStartupJob& StartupJob, TSharedPtr<FStreamableHandle>& LoadHandle){JobFunc;}, JobWeight, { __VA_ARGS__ }))
+
+//////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static bool bSerialStartupJobs = false;
+    static FAutoConsoleVariableRef CVarSerialStartupJobs
+    (
+        TEXT("OT.AssetManager.SerialStartupJobs"),
+        bSerialStartupJobs,
+        TEXT("Run asset manager startup jobs one after another in declaration order instead of overlapping independent jobs."),
+        ECVF_Default
+    );
+}
 
 //////////////////////////////////////////////////////////////////////
 
@@ -113,12 +130,13 @@ void UUR_AssetManager::StartInitialLoading()
     // This does all of the scanning, need to do this now even if loads are deferred
     Super::StartInitialLoading();
 
+    // Ready jobs are started in declaration order. The base game data load is declared first so that it streams in
+    // while the gameplay cue manager initializes on the game thread.
+    const int32 StartGameDataLoadJob = STARTUP_JOB_WEIGHTED(LoadHandle = StartGameDataLoad(), 24.f);
+
     STARTUP_JOB(InitializeGameplayCueManager());
 
-    {
-        // Load base game data asset
-        STARTUP_JOB_WEIGHTED(GetGameData(), 25.f);
-    }
+    STARTUP_JOB_AFTER(GetGameData(), 1.f, StartGameDataLoadJob);
 
     // Run all the queued up startup jobs
     DoAllStartupJobs();
@@ -134,6 +152,17 @@ void UUR_AssetManager::InitializeGameplayCueManager()
 }
 
 
+TSharedPtr<FStreamableHandle> UUR_AssetManager::StartGameDataLoad()
+{
+    // The editor loads GameData synchronously on demand, see LoadGameDataOfClass
+    if (GIsEditor || GameDataPath.IsNull() || GameDataMap.Contains(UUR_GameData::StaticClass()))
+    {
+        return nullptr;
+    }
+
+    return LoadPrimaryAssetsWithType(UUR_GameData::StaticClass()->GetFName());
+}
+
 const UUR_GameData& UUR_AssetManager::GetGameData()
 {
     return GetOrLoadTypedGameData<UUR_GameData>(GameDataPath);
@@ -203,17 +232,17 @@ void UUR_AssetManager::DoAllStartupJobs()
     SCOPED_BOOT_TIMING("UUR_AssetManager::DoAllStartupJobs");
     const double AllStartupJobsStartTime = FPlatformTime::Seconds();
 
-    if (IsRunningDedicatedServer())
+    if (OTConsoleVariables::bSerialStartupJobs)
     {
-        // No need for periodic progress updates, just run the jobs
         for (const FGameAssetManagerStartupJob& StartupJob : StartupJobs)
         {
             StartupJob.DoJob();
         }
     }
-    else
+    else if (StartupJobs.Num() > 0)
     {
-        if (StartupJobs.Num() > 0)
+        // No need for periodic progress updates on dedicated servers
+        if (!IsRunningDedicatedServer())
         {
             float TotalJobValue = 0.0f;
             for (const FGameAssetManagerStartupJob& StartupJob : StartupJobs)
@@ -221,36 +250,138 @@ void UUR_AssetManager::DoAllStartupJobs()
                 TotalJobValue += StartupJob.JobWeight;
             }
 
-            float AccumulatedJobValue = 0.0f;
             for (FGameAssetManagerStartupJob& StartupJob : StartupJobs)
             {
-                const float JobValue = StartupJob.JobWeight;
-                StartupJob.SubstepProgressDelegate.BindLambda([This = this, AccumulatedJobValue, JobValue, TotalJobValue](float NewProgress)
+                StartupJob.SubstepProgressDelegate.BindLambda([This = this, TotalJobValue](float NewProgress)
                 {
-                    const float SubstepAdjustment = FMath::Clamp(NewProgress, 0.0f, 1.0f) * JobValue;
-                    const float OverallPercentWithSubstep = (AccumulatedJobValue + SubstepAdjustment) / TotalJobValue;
-
-                    This->UpdateInitialGameContentLoadPercent(OverallPercentWithSubstep);
+                    This->UpdateInitialGameContentLoadPercent(This->GetStartupJobsProgress(TotalJobValue));
                 });
+            }
+        }
 
-                StartupJob.DoJob();
+        RunStartupJobGraph();
+        LogStartupJobTimings();
+    }
 
-                StartupJob.SubstepProgressDelegate.Unbind();
+    if (StartupJobs.Num() == 0)
+    {
+        UpdateInitialGameContentLoadPercent(1.0f);
+    }
 
-                AccumulatedJobValue += JobValue;
+    StartupJobs.Empty();
+
+    UE_LOG(LogGame, Display, TEXT("All startup jobs took %.2f seconds to complete"), FPlatformTime::Seconds() - AllStartupJobsStartTime);
+}
+
+void UUR_AssetManager::RunStartupJobGraph()
+{
+    // Drop dependencies that do not point at an earlier job. Only allowing backward edges keeps the graph acyclic.
+    for (int32 JobIndex = 0; JobIndex < StartupJobs.Num(); ++JobIndex)
+    {
+        FGameAssetManagerStartupJob& StartupJob = StartupJobs[JobIndex];
+        for (int32 DepIndex = StartupJob.Dependencies.Num() - 1; DepIndex >= 0; --DepIndex)
+        {
+            const int32 Dependency = StartupJob.Dependencies[DepIndex];
+            if (!ensureMsgf(Dependency >= 0 && Dependency < JobIndex, TEXT("Startup job \"%s\" has invalid dependency %d"), *StartupJob.JobName, Dependency))
+            {
+                StartupJob.Dependencies.RemoveAtSwap(DepIndex);
+            }
+        }
+    }
 
-                UpdateInitialGameContentLoadPercent(AccumulatedJobValue / TotalJobValue);
+    auto AreDependenciesComplete = [this](const FGameAssetManagerStartupJob& StartupJob)
+    {
+        for (const int32 Dependency : StartupJob.Dependencies)
+        {
+            if (StartupJobs[Dependency].GetState() != EGameAssetManagerStartupJobState::Complete)
+            {
+                return false;
             }
         }
-        else
+        return true;
+    };
+
+    auto IsAnyRunningJobDone = [this]()
+    {
+        for (const FGameAssetManagerStartupJob& StartupJob : StartupJobs)
+        {
+            if (StartupJob.GetState() == EGameAssetManagerStartupJobState::Running && StartupJob.IsWorkComplete())
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    int32 NumCompleted = 0;
+    while (NumCompleted < StartupJobs.Num())
+    {
+        // Kick off everything that is ready. Game thread jobs run their function here, async loads they start keep streaming while we continue.
+        for (FGameAssetManagerStartupJob& StartupJob : StartupJobs)
+        {
+            if (StartupJob.GetState() == EGameAssetManagerStartupJobState::Pending && AreDependenciesComplete(StartupJob))
+            {
+                StartupJob.StartJob();
+            }
+        }
+
+        // Retire finished jobs, which may unblock dependents on the next pass
+        bool bRetiredAny = false;
+        for (FGameAssetManagerStartupJob& StartupJob : StartupJobs)
+        {
+            if (StartupJob.GetState() == EGameAssetManagerStartupJobState::Running && StartupJob.IsWorkComplete())
+            {
+                StartupJob.FinishJob();
+                ++NumCompleted;
+                bRetiredAny = true;
+            }
+        }
+
+        if (!bRetiredAny && NumCompleted < StartupJobs.Num())
         {
-            UpdateInitialGameContentLoadPercent(1.0f);
+            // Pump async loading for every in flight handle at once until at least one job can be retired
+            ProcessAsyncLoadingUntilComplete(IsAnyRunningJobDone, 0.1);
         }
     }
+}
 
-    StartupJobs.Empty();
+float UUR_AssetManager::GetStartupJobsProgress(float TotalJobValue) const
+{
+    if (TotalJobValue <= 0.0f)
+    {
+        return 1.0f;
+    }
 
-    UE_LOG(LogGame, Display, TEXT("All startup jobs took %.2f seconds to complete"), FPlatformTime::Seconds() - AllStartupJobsStartTime);
+    float AccumulatedJobValue = 0.0f;
+    for (const FGameAssetManagerStartupJob& StartupJob : StartupJobs)
+    {
+        AccumulatedJobValue += FMath::Clamp(StartupJob.GetProgress(), 0.0f, 1.0f) * StartupJob.JobWeight;
+    }
+    return AccumulatedJobValue / TotalJobValue;
+}
+
+void UUR_AssetManager::LogStartupJobTimings() const
+{
+    TArray<const FGameAssetManagerStartupJob*> SortedJobs;
+    SortedJobs.Reserve(StartupJobs.Num());
+    for (const FGameAssetManagerStartupJob& StartupJob : StartupJobs)
+    {
+        SortedJobs.Add(&StartupJob);
+    }
+    SortedJobs.Sort([](const FGameAssetManagerStartupJob& A, const FGameAssetManagerStartupJob& B)
+    {
+        return A.GetTotalSeconds() > B.GetTotalSeconds();
+    });
+
+    UE_LOG(LogGame, Display, TEXT("========== Startup job timings =========="));
+    for (const FGameAssetManagerStartupJob* StartupJob : SortedJobs)
+    {
+        const FString Timing = FString::Printf(TEXT("StartupJob %s: total %.3fs (queued %.3fs, run %.3fs, async wait %.3fs)"),
+            *StartupJob->JobName, StartupJob->GetTotalSeconds(), StartupJob->GetQueuedSeconds(), StartupJob->GetRunSeconds(), StartupJob->GetWaitSeconds());
+
+        UE_LOG(LogGame, Display, TEXT("  %s"), *Timing);
+        BootTimingPoint(TCHAR_TO_ANSI(*Timing));
+    }
 }
 
 void UUR_AssetManager::UpdateInitialGameContentLoadPercent(float GameContentPercent)
@@ -102,9 +102,21 @@ private:
     // Flushes the StartupJobs array. Processes all startup work.
     void DoAllStartupJobs();
 
+    // Runs the startup jobs as a dependency graph, overlapping the async loads of independent jobs
+    void RunStartupJobGraph();
+
+    // Weighted progress of all startup jobs, in [0, 1]
+    float GetStartupJobsProgress(float TotalJobValue) const;
+
+    // Writes the per job timing breakdown to the log and the boot timing log
+    void LogStartupJobTimings() const;
+
     // Sets up the ability system
     void InitializeGameplayCueManager();
 
+    // Starts streaming the GameData primary assets without waiting on them
+    TSharedPtr<FStreamableHandle> StartGameDataLoad();
+
     // Called periodically during loads, could be used to feed the status to a loading screen
     void UpdateInitialGameContentLoadPercent(float GameContentPercent);
 
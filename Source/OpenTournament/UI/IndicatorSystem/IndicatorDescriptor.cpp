@@ -17,38 +17,21 @@ bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescript
 {
     if (USceneComponent* Component = IndicatorDescriptor.GetSceneComponent())
     {
-        TOptional<FVector> WorldLocation;
-        if (IndicatorDescriptor.GetComponentSocketName() != NAME_None)
-        {
-            WorldLocation = Component->GetSocketTransform(IndicatorDescriptor.GetComponentSocketName()).GetLocation();
-        }
-        else
-        {
-            WorldLocation = Component->GetComponentLocation();
-        }
-
-        const FVector ProjectWorldLocation = WorldLocation.GetValue() + IndicatorDescriptor.GetWorldPositionOffset();
         const EActorCanvasProjectionMode ProjectionMode = IndicatorDescriptor.GetProjectionMode();
 
         switch (ProjectionMode)
         {
             case EActorCanvasProjectionMode::ComponentPoint:
+            case EActorCanvasProjectionMode::ActorBoundingBox:
+            case EActorCanvasProjectionMode::ComponentBoundingBox:
             {
-                if (WorldLocation.IsSet())
+                FVector ProjectWorldLocation;
+                if (GetProjectionWorldPoint(IndicatorDescriptor, ProjectWorldLocation))
                 {
                     FVector2D OutScreenSpacePosition;
                     const bool bInFrontOfCamera = ULocalPlayer::GetPixelPoint(InProjectionData, ProjectWorldLocation, OutScreenSpacePosition, &ScreenSize);
 
-                    OutScreenSpacePosition.X += IndicatorDescriptor.GetScreenSpaceOffset().X * (bInFrontOfCamera ? 1 : -1);
-                    OutScreenSpacePosition.Y += IndicatorDescriptor.GetScreenSpaceOffset().Y;
-
-                    if (!bInFrontOfCamera && FBox2f(FVector2f::Zero(), ScreenSize).IsInside((FVector2f)OutScreenSpacePosition))
-                    {
-                        const FVector2f CenterToPosition = (FVector2f(OutScreenSpacePosition) - (ScreenSize / 2)).GetSafeNormal();
-                        OutScreenSpacePosition = FVector2D((ScreenSize / 2) + CenterToPosition * ScreenSize);
-                    }
-
-                    OutScreenPositionWithDepth = FVector(OutScreenSpacePosition.X, OutScreenSpacePosition.Y, FVector::Dist(InProjectionData.ViewOrigin, ProjectWorldLocation));
+                    OutScreenPositionWithDepth = FinishPointProjection(IndicatorDescriptor, ScreenSize, OutScreenSpacePosition, bInFrontOfCamera, FVector::Dist(InProjectionData.ViewOrigin, ProjectWorldLocation));
 
                     return true;
                 }
@@ -58,6 +41,17 @@ bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescript
             case EActorCanvasProjectionMode::ComponentScreenBoundingBox:
             case EActorCanvasProjectionMode::ActorScreenBoundingBox:
             {
+                FVector ProjectWorldLocation;
+                if (IndicatorDescriptor.GetComponentSocketName() != NAME_None)
+                {
+                    ProjectWorldLocation = Component->GetSocketTransform(IndicatorDescriptor.GetComponentSocketName()).GetLocation();
+                }
+                else
+                {
+                    ProjectWorldLocation = Component->GetComponentLocation();
+                }
+                ProjectWorldLocation += IndicatorDescriptor.GetWorldPositionOffset();
+
                 FBox IndicatorBox;
                 if (ProjectionMode == EActorCanvasProjectionMode::ActorScreenBoundingBox)
                 {
@@ -72,59 +66,102 @@ bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescript
                 const bool bInFrontOfCamera = ULocalPlayer::GetPixelBoundingBox(InProjectionData, IndicatorBox, LL, UR, &ScreenSize);
 
                 const FVector& BoundingBoxAnchor = IndicatorDescriptor.GetBoundingBoxAnchor();
-                const FVector2D& ScreenSpaceOffset = IndicatorDescriptor.GetScreenSpaceOffset();
+                const FVector2D ScreenSpacePosition(FMath::Lerp(LL.X, UR.X, BoundingBoxAnchor.X), FMath::Lerp(LL.Y, UR.Y, BoundingBoxAnchor.Y));
 
-                FVector ScreenPositionWithDepth;
-                ScreenPositionWithDepth.X = FMath::Lerp(LL.X, UR.X, BoundingBoxAnchor.X) + ScreenSpaceOffset.X * (bInFrontOfCamera ? 1 : -1);
-                ScreenPositionWithDepth.Y = FMath::Lerp(LL.Y, UR.Y, BoundingBoxAnchor.Y) + ScreenSpaceOffset.Y;
-                ScreenPositionWithDepth.Z = FVector::Dist(InProjectionData.ViewOrigin, ProjectWorldLocation);
+                OutScreenPositionWithDepth = FinishPointProjection(IndicatorDescriptor, ScreenSize, ScreenSpacePosition, bInFrontOfCamera, FVector::Dist(InProjectionData.ViewOrigin, ProjectWorldLocation));
+                return true;
+            }
+        }
+    }
 
-                const FVector2f ScreenSpacePosition = FVector2f(FVector2D(ScreenPositionWithDepth));
-                if (!bInFrontOfCamera && FBox2f(FVector2f::Zero(), ScreenSize).IsInside(ScreenSpacePosition))
-                {
-                    const FVector2f CenterToPosition = (ScreenSpacePosition - (ScreenSize / 2)).GetSafeNormal();
-                    const FVector2f ScreenPositionFromBehind = (ScreenSize / 2) + CenterToPosition * ScreenSize;
-                    ScreenPositionWithDepth.X = ScreenPositionFromBehind.X;
-                    ScreenPositionWithDepth.Y = ScreenPositionFromBehind.Y;
-                }
+    return false;
+}
 
-                OutScreenPositionWithDepth = ScreenPositionWithDepth;
-                return true;
+bool FIndicatorProjection::GetProjectionWorldPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint)
+{
+    USceneComponent* Component = IndicatorDescriptor.GetSceneComponent();
+    if (Component == nullptr)
+    {
+        return false;
+    }
+
+    switch (IndicatorDescriptor.GetProjectionMode())
+    {
+        case EActorCanvasProjectionMode::ComponentPoint:
+        {
+            if (IndicatorDescriptor.GetComponentSocketName() != NAME_None)
+            {
+                OutWorldPoint = Component->GetSocketTransform(IndicatorDescriptor.GetComponentSocketName()).GetLocation();
             }
-            case EActorCanvasProjectionMode::ActorBoundingBox:
-            case EActorCanvasProjectionMode::ComponentBoundingBox:
+            else
             {
-                FBox IndicatorBox;
-                if (ProjectionMode == EActorCanvasProjectionMode::ActorBoundingBox)
-                {
-                    IndicatorBox = Component->GetOwner()->GetComponentsBoundingBox();
-                }
-                else
-                {
-                    IndicatorBox = Component->Bounds.GetBox();
-                }
+                OutWorldPoint = Component->GetComponentLocation();
+            }
+            OutWorldPoint += IndicatorDescriptor.GetWorldPositionOffset();
+            return true;
+        }
+        case EActorCanvasProjectionMode::ActorBoundingBox:
+        case EActorCanvasProjectionMode::ComponentBoundingBox:
+        {
+            FBox IndicatorBox;
+            if (IndicatorDescriptor.GetProjectionMode() == EActorCanvasProjectionMode::ActorBoundingBox)
+            {
+                IndicatorBox = Component->GetOwner()->GetComponentsBoundingBox();
+            }
+            else
+            {
+                IndicatorBox = Component->Bounds.GetBox();
+            }
+
+            OutWorldPoint = IndicatorBox.GetCenter() + (IndicatorBox.GetSize() * (IndicatorDescriptor.GetBoundingBoxAnchor() - FVector(0.5)));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
 
-                const FVector ProjectBoxPoint = IndicatorBox.GetCenter() + (IndicatorBox.GetSize() * (IndicatorDescriptor.GetBoundingBoxAnchor() - FVector(0.5)));
+void FIndicatorProjection::ProjectPoints(const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize, TConstArrayView<FVector> WorldPoints, TArrayView<FVector2D> OutScreenPositions, TArrayView<bool> OutInFrontOfCamera)
+{
+    check(OutScreenPositions.Num() == WorldPoints.Num() && OutInFrontOfCamera.Num() == WorldPoints.Num());
 
-                FVector2D OutScreenSpacePosition;
-                const bool bInFrontOfCamera = ULocalPlayer::GetPixelPoint(InProjectionData, ProjectBoxPoint, OutScreenSpacePosition, &ScreenSize);
-                OutScreenSpacePosition.X += IndicatorDescriptor.GetScreenSpaceOffset().X * (bInFrontOfCamera ? 1 : -1);
-                OutScreenSpacePosition.Y += IndicatorDescriptor.GetScreenSpaceOffset().Y;
+    // Points are made relative to the view origin first (same as the translation in ComputeViewProjectionMatrix),
+    // which keeps them and the matrix precise in floats on large maps.
+    const FMatrix44f ViewProjectionMatrix(InProjectionData.ViewRotationMatrix * InProjectionData.ProjectionMatrix);
 
-                if (!bInFrontOfCamera && FBox2f(FVector2f::Zero(), ScreenSize).IsInside((FVector2f)OutScreenSpacePosition))
-                {
-                    const FVector2f CenterToPosition = (FVector2f(OutScreenSpacePosition) - (ScreenSize / 2)).GetSafeNormal();
-                    OutScreenSpacePosition = FVector2D((ScreenSize / 2) + CenterToPosition * ScreenSize);
-                }
+    for (int32 PointIndex = 0; PointIndex < WorldPoints.Num(); ++PointIndex)
+    {
+        const FVector3f RelativePoint(WorldPoints[PointIndex] - InProjectionData.ViewOrigin);
+        const VectorRegister4Float ClipPosition = VectorTransformVector(VectorLoadFloat3_W1(&RelativePoint.X), &ViewProjectionMatrix);
 
-                OutScreenPositionWithDepth = FVector(OutScreenSpacePosition.X, OutScreenSpacePosition.Y, FVector::Dist(InProjectionData.ViewOrigin, ProjectBoxPoint));
+        FVector4f Result;
+        VectorStore(ClipPosition, &Result.X);
 
-                return true;
-            }
-        }
+        OutInFrontOfCamera[PointIndex] = (Result.W >= 0.f);
+
+        // Prevent divide by zero, mirror points behind the camera like GetPixelPoint does
+        const float RHW = 1.0f / (Result.W == 0.f ? 1.f : FMath::Abs(Result.W));
+
+        // Move from projection space to normalized 0..1 UI space
+        const float NormX = (Result.X * RHW / 2.f) + 0.5f;
+        const float NormY = 1.f - (Result.Y * RHW / 2.f) - 0.5f;
+
+        OutScreenPositions[PointIndex] = FVector2D(NormX * ScreenSize.X, NormY * ScreenSize.Y);
     }
+}
 
-    return false;
+FVector FIndicatorProjection::FinishPointProjection(const UIndicatorDescriptor& IndicatorDescriptor, const FVector2f& ScreenSize, FVector2D ScreenPosition, bool bInFrontOfCamera, double Depth)
+{
+    ScreenPosition.X += IndicatorDescriptor.GetScreenSpaceOffset().X * (bInFrontOfCamera ? 1 : -1);
+    ScreenPosition.Y += IndicatorDescriptor.GetScreenSpaceOffset().Y;
+
+    if (!bInFrontOfCamera && FBox2f(FVector2f::Zero(), ScreenSize).IsInside((FVector2f)ScreenPosition))
+    {
+        const FVector2f CenterToPosition = (FVector2f(ScreenPosition) - (ScreenSize / 2)).GetSafeNormal();
+        ScreenPosition = FVector2D((ScreenSize / 2) + CenterToPosition * ScreenSize);
+    }
+
+    return FVector(ScreenPosition.X, ScreenPosition.Y, Depth);
 }
 
 void UIndicatorDescriptor::SetIndicatorManagerComponent(UUR_IndicatorManagerComponent* InManager)
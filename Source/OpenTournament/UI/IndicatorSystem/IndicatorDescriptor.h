@@ -25,6 +25,21 @@ struct FSceneViewProjectionData;
 struct FIndicatorProjection
 {
     bool Project(const UIndicatorDescriptor& IndicatorDescriptor, const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize, FVector& ScreenPositionWithDepth);
+
+    /**
+     * Resolves the single world point an indicator projects from.
+     * Returns false for screen bounding box modes, which have to project the whole box through Project().
+     */
+    static bool GetProjectionWorldPoint(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldPoint);
+
+    /**
+     * Projects all points to pixel positions in one pass, sharing a single view projection matrix.
+     * Matches ULocalPlayer::GetPixelPoint for each point.
+     */
+    static void ProjectPoints(const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize, TConstArrayView<FVector> WorldPoints, TArrayView<FVector2D> OutScreenPositions, TArrayView<bool> OutInFrontOfCamera);
+
+    /** Applies the indicator screen space offset and behind-camera mirroring to a projected point */
+    static FVector FinishPointProjection(const UIndicatorDescriptor& IndicatorDescriptor, const FVector2f& ScreenSize, FVector2D ScreenPosition, bool bInFrontOfCamera, double Depth);
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
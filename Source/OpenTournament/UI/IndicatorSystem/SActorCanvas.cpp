@@ -145,10 +145,18 @@ void SActorCanvas::Construct(const FArguments& InArgs, const FLocalPlayerContext
     SetVisibility(EVisibility::SelfHitTestInvisible);
 
     // Create 10 arrows for starters
-    for (int32 i = 0; i < 10; ++i)
+    EnsureArrowPool(10);
+
+    UpdateActiveTimer();
+}
+
+void SActorCanvas::EnsureArrowPool(int32 NumArrows)
+{
+    while (ArrowWidgets.Num() < NumArrows)
     {
         TSharedRef<SActorCanvasArrowWidget> ArrowWidget = SNew(SActorCanvasArrowWidget, ActorCanvasArrowBrush);
         ArrowWidget->SetVisibility(EVisibility::Collapsed);
+        ArrowWidgets.Add(ArrowWidget);
 
         ArrowChildren.AddSlot
         (MoveTemp
@@ -159,8 +167,6 @@ void SActorCanvas::Construct(const FArguments& InArgs, const FLocalPlayerContext
                 ]
             ));
     }
-
-    UpdateActiveTimer();
 }
 
 EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float InDeltaTime)
@@ -211,7 +217,15 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
             SetShowAnyIndicators(true);
 
             bool IndicatorsChanged = false;
+            int32 NumArrowIndicators = 0;
+
+            const FVector2f ScreenSize = PaintGeometry.Size;
+            FIndicatorProjection Projector;
 
+            BatchedSlotIndices.Reset();
+            BatchedWorldPoints.Reset();
+
+            // Drop dead indicators, refresh visibility and gather the world points to project
             for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
             {
                 SActorCanvas::FSlot& CurChild = CanvasChildren[ChildIndex];
@@ -237,6 +251,11 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
                     continue;
                 }
 
+                if (Indicator->GetClampToScreen() && Indicator->GetShowClampToScreenArrow())
+                {
+                    ++NumArrowIndicators;
+                }
+
                 // If the indicator changed clamp status between updates, alert the indicator and mark the indicators as changed
                 if (CurChild.WasIndicatorClampedStatusChanged())
                 {
@@ -245,37 +264,52 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
                     IndicatorsChanged = true;
                 }
 
-                FVector ScreenPositionWithDepth;
-
-                FIndicatorProjection Projector;
-                const bool Success = Projector.Project(*Indicator, ProjectionData, PaintGeometry.Size, OUT ScreenPositionWithDepth);
-
-                if (!Success)
+                FVector WorldPoint;
+                if (FIndicatorProjection::GetProjectionWorldPoint(*Indicator, WorldPoint))
                 {
-                    CurChild.SetHasValidScreenPosition(false);
-                    CurChild.SetInFrontOfCamera(false);
-
-                    IndicatorsChanged |= CurChild.IsDirty();
-                    CurChild.ClearDirtyFlag();
+                    BatchedSlotIndices.Add(ChildIndex);
+                    BatchedWorldPoints.Add(WorldPoint);
                     continue;
                 }
 
-                CurChild.SetInFrontOfCamera(Success);
-                CurChild.SetHasValidScreenPosition(CurChild.GetInFrontOfCamera() || Indicator->GetClampToScreen());
+                // Screen bounding box modes need every corner of the box, project them on their own
+                FVector ScreenPositionWithDepth;
+                const bool Success = Projector.Project(*Indicator, ProjectionData, ScreenSize, OUT ScreenPositionWithDepth);
+                IndicatorsChanged |= ApplyProjectionToSlot(CurChild, Success, ScreenPositionWithDepth);
+            }
 
-                if (CurChild.HasValidScreenPosition())
-                {
-                    // Only dirty the screen position if we can actually show this indicator.
-                    CurChild.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
-                    CurChild.SetDepth(ScreenPositionWithDepth.X);
-                }
+            // Project every gathered point in a single pass
+            const int32 NumBatched = BatchedWorldPoints.Num();
+            BatchedScreenPositions.SetNumUninitialized(NumBatched, EAllowShrinking::No);
+            BatchedInFrontOfCamera.SetNumUninitialized(NumBatched, EAllowShrinking::No);
+            FIndicatorProjection::ProjectPoints(ProjectionData, ScreenSize, BatchedWorldPoints, BatchedScreenPositions, BatchedInFrontOfCamera);
 
-                CurChild.SetPriority(Indicator->GetPriority());
+            for (int32 BatchIndex = 0; BatchIndex < NumBatched; ++BatchIndex)
+            {
+                SActorCanvas::FSlot& CurChild = CanvasChildren[BatchedSlotIndices[BatchIndex]];
+                const double Depth = FVector::Dist(ProjectionData.ViewOrigin, BatchedWorldPoints[BatchIndex]);
+                const FVector ScreenPositionWithDepth = FIndicatorProjection::FinishPointProjection(*CurChild.Indicator, ScreenSize, BatchedScreenPositions[BatchIndex], BatchedInFrontOfCamera[BatchIndex], Depth);
 
-                IndicatorsChanged |= CurChild.IsDirty();
-                CurChild.ClearDirtyFlag();
+                IndicatorsChanged |= ApplyProjectionToSlot(CurChild, true, ScreenPositionWithDepth);
+            }
+
+            // Re-sort only if the draw order actually changed
+            if (!bSortedSlotsDirty)
+            {
+                for (int32 SortedIndex = 1; SortedIndex < SortedSlots.Num(); ++SortedIndex)
+                {
+                    const SActorCanvas::FSlot& Prev = *SortedSlots[SortedIndex - 1];
+                    const SActorCanvas::FSlot& Cur = *SortedSlots[SortedIndex];
+                    if (Cur.GetPriority() == Prev.GetPriority() ? Cur.GetDepth() > Prev.GetDepth() : Cur.GetPriority() < Prev.GetPriority())
+                    {
+                        bSortedSlotsDirty = true;
+                        break;
+                    }
+                }
             }
 
+            EnsureArrowPool(NumArrowIndicators);
+
             if (IndicatorsChanged)
             {
                 Invalidate(EInvalidateWidget::Paint);
@@ -302,6 +336,56 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
     }
 }
 
+bool SActorCanvas::ApplyProjectionToSlot(FSlot& Slot, bool bProjected, const FVector& ScreenPositionWithDepth)
+{
+    if (!bProjected)
+    {
+        Slot.SetHasValidScreenPosition(false);
+        Slot.SetInFrontOfCamera(false);
+    }
+    else
+    {
+        Slot.SetInFrontOfCamera(bProjected);
+        Slot.SetHasValidScreenPosition(Slot.GetInFrontOfCamera() || Slot.Indicator->GetClampToScreen());
+
+        if (Slot.HasValidScreenPosition())
+        {
+            // Only dirty the screen position if we can actually show this indicator.
+            Slot.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
+            Slot.SetDepth(ScreenPositionWithDepth.Z);
+        }
+
+        Slot.SetPriority(Slot.Indicator->GetPriority());
+    }
+
+    const bool bChanged = Slot.IsDirty();
+    Slot.ClearDirtyFlag();
+    return bChanged;
+}
+
+void SActorCanvas::RefreshSortedSlots() const
+{
+    if (!bSortedSlotsDirty)
+    {
+        return;
+    }
+
+    // Reset keeps the allocation, this does not allocate once the canvas has seen its peak indicator count
+    SortedSlots.Reset();
+    for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
+    {
+        SortedSlots.Add(&CanvasChildren[ChildIndex]);
+    }
+
+    SortedSlots.StableSort
+    ([](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
+    {
+        return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
+    });
+
+    bSortedSlotsDirty = false;
+}
+
 void SActorCanvas::SetShowAnyIndicators(bool bIndicators)
 {
     if (bShowAnyIndicators != bIndicators)
@@ -331,18 +415,7 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
         const FIntPoint FixedPadding = FIntPoint(10.0f, 10.0f) + FIntPoint(ArrowWidgetSize.X, ArrowWidgetSize.Y);
         const FVector Center = FVector(AllottedGeometry.Size * 0.5f, 0.0f);
 
-        // Sort the children
-        TArray<const SActorCanvas::FSlot*> SortedSlots;
-        for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
-        {
-            SortedSlots.Add(&CanvasChildren[ChildIndex]);
-        }
-
-        SortedSlots.StableSort
-        ([](const SActorCanvas::FSlot& A, const SActorCanvas::FSlot& B)
-        {
-            return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
-        });
+        RefreshSortedSlots();
 
         // Go through all the sorted children
         for (int32 ChildIndex = 0; ChildIndex < SortedSlots.Num(); ++ChildIndex)
@@ -440,13 +513,13 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
                 // should we show an arrow
                 if (Indicator->GetShowClampToScreenArrow() &&
                     bWasIndicatorClamped &&
-                    ArrowChildren.IsValidIndex(NextArrowIndex))
+                    ArrowWidgets.IsValidIndex(NextArrowIndex))
                 {
                     const FVector2D ArrowOffsetDirection = ArrowOffsets[ClampDir];
                     const float ArrowRotation = ArrowRotations[ClampDir];
 
                     //grab an arrow widget
-                    TSharedRef<SActorCanvasArrowWidget> ArrowWidgetToUse = StaticCastSharedRef<SActorCanvasArrowWidget>(ArrowChildren.GetChildAt(NextArrowIndex));
+                    const TSharedRef<SActorCanvasArrowWidget>& ArrowWidgetToUse = ArrowWidgets[NextArrowIndex];
                     NextArrowIndex++;
 
                     //set the rotation of the arrow
@@ -517,7 +590,7 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
     {
         for (int32 ArrowRemovedIndex = NextArrowIndex; ArrowRemovedIndex < ArrowIndexLastUpdate; ArrowRemovedIndex++)
         {
-            ArrowChildren.GetChildAt(ArrowRemovedIndex)->SetVisibility(EVisibility::Collapsed);
+            ArrowWidgets[ArrowRemovedIndex]->SetVisibility(EVisibility::Collapsed);
         }
     }
 
@@ -657,6 +730,7 @@ SActorCanvas::FScopedWidgetSlotArguments SActorCanvas::AddActorSlot(UIndicatorDe
         {
             if (TSharedPtr<SActorCanvas> Canvas = WeakCanvas.Pin())
             {
+                Canvas->bSortedSlotsDirty = true;
                 Canvas->UpdateActiveTimer();
             }
         }
@@ -670,6 +744,7 @@ int32 SActorCanvas::RemoveActorSlot(const TSharedRef<SWidget>& SlotWidget)
         if (SlotWidget == CanvasChildren[SlotIdx].GetWidget())
         {
             CanvasChildren.RemoveAt(SlotIdx);
+            bSortedSlotsDirty = true;
 
             UpdateActiveTimer();
 
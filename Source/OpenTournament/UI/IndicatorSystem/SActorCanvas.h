@@ -18,6 +18,7 @@ class FReferenceCollector;
 class FSlateRect;
 class FSlateWindowElementList;
 class FWidgetStyle;
+class SActorCanvasArrowWidget;
 class UIndicatorDescriptor;
 class UUR_IndicatorManagerComponent;
 struct FSlateBrush;
@@ -270,6 +271,15 @@ private:
     void SetShowAnyIndicators(bool bIndicators);
     EActiveTimerReturnType UpdateCanvas(double InCurrentTime, float InDeltaTime);
 
+    /** Applies a projection result to the slot, returns true if the slot changed */
+    static bool ApplyProjectionToSlot(FSlot& Slot, bool bProjected, const FVector& ScreenPositionWithDepth);
+
+    /** Rebuilds SortedSlots if slots were added or removed, or if their priority / depth order changed */
+    void RefreshSortedSlots() const;
+
+    /** Grows the off-screen arrow pool so arranging never runs out of arrows */
+    void EnsureArrowPool(int32 NumArrows);
+
     /** Helper function for calculating the offset */
     void GetOffsetAndSize(const UIndicatorDescriptor* Indicator,
                           FVector2D& OutSize,
@@ -295,6 +305,19 @@ private:
 
     const FSlateBrush* ActorCanvasArrowBrush = nullptr;
 
+    /** Arrow widgets of ArrowChildren, kept typed to avoid a cast per arrow per arrange */
+    TArray<TSharedRef<SActorCanvasArrowWidget>> ArrowWidgets;
+
+    /** Canvas slots in draw order. Persistent, only re-sorted when bSortedSlotsDirty. */
+    mutable TArray<const FSlot*> SortedSlots;
+    mutable bool bSortedSlotsDirty = true;
+
+    /** Scratch buffers for the batched projection, reused every update */
+    TArray<int32> BatchedSlotIndices;
+    TArray<FVector> BatchedWorldPoints;
+    TArray<FVector2D> BatchedScreenPositions;
+    TArray<bool> BatchedInFrontOfCamera;
+
     mutable int32 NextArrowIndex = 0;
     mutable int32 ArrowIndexLastUpdate = 0;
 
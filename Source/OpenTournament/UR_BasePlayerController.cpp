@@ -13,6 +13,7 @@
 #include "UR_PlayerInput.h"
 #include "UR_UserSettings.h"
 #include "Camera/UR_PlayerCameraManager.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_BasePlayerController)
 
@@ -37,6 +38,20 @@ void AUR_BasePlayerController::PostInitializeComponents()
     Super::PostInitializeComponents();
 }
 
+void AUR_BasePlayerController::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Controller);
+}
+
+void AUR_BasePlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Controller);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AUR_BasePlayerController::InitInputSystem()
 {
     // if (PlayerInput == nullptr)
@@ -36,6 +36,10 @@ public:
 
     virtual void PostInitializeComponents() override;
 
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     virtual void InitInputSystem() override;
 
     virtual void SpawnPlayerCameraManager() override;
@@ -4,6 +4,7 @@
 
 #include "UR_ChatComponent.h"
 
+#include "TimerManager.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/PlayerState.h"
 
@@ -11,6 +12,7 @@
 #include "UR_FunctionLibrary.h"
 #include "UR_GameModeBase.h"
 #include "UR_GameState.h"
+#include "UR_PlayerState.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -29,6 +31,12 @@ UUR_ChatComponent::UUR_ChatComponent()
     , AntiSpamDelay(1.f)
     , LastSendTime(0)
     , MaxMessageLength(150)
+    , RateLimitBurst(4.f)
+    , RateLimitTokensPerSecond(0.5f)
+    , MaxPendingMessages(16)
+    , RateLimitTokens(4.f)
+    , RateLimitLastRefillTime(0)
+    , bFlushScheduled(false)
 {
     SetIsReplicatedByDefault(true);
 }
@@ -44,6 +52,13 @@ void UUR_ChatComponent::BeginPlay()
     if (AUR_GameModeBase* URGameMode = GetWorld()->GetAuthGameMode<AUR_GameModeBase>())
     {
         URGameMode->RegisterChatComponent(this);
+
+        // Recipient sets depend on our team
+        if (AUR_PlayerState* PS = OwnerController ? OwnerController->GetPlayerState<AUR_PlayerState>() : nullptr)
+        {
+            PS->OnTeamChanged.AddUniqueDynamic(this, &ThisClass::OnOwnerTeamIndexChanged);
+            PS->GetTeamChangedDelegateChecked().AddUniqueDynamic(this, &ThisClass::OnOwnerTeamIdChanged);
+        }
     }
 }
 
@@ -66,6 +81,10 @@ void UUR_ChatComponent::Send(const FString& Message, bool bTeamMessage)
 
         if (GetOwnerRole() == ROLE_Authority)
         {
+            if (!ConsumeRateLimitToken())
+            {
+                return;
+            }
             Broadcast(ValidatedMessage, bTeamMessage ? GetTeamIndex() : CHAT_INDEX_GLOBAL);
         }
         else
@@ -105,14 +124,31 @@ FString UUR_ChatComponent::Validate_Implementation(const FString& Message, bool
     return ValidatedMessage;
 }
 
+bool UUR_ChatComponent::ConsumeRateLimitToken()
+{
+    const double Now = GetWorld()->GetRealTimeSeconds();
+    RateLimitTokens = FMath::Min<float>(RateLimitBurst, RateLimitTokens + (Now - RateLimitLastRefillTime) * RateLimitTokensPerSecond);
+    RateLimitLastRefillTime = Now;
+
+    if (RateLimitTokens < 1.f)
+    {
+        return false;
+    }
+
+    RateLimitTokens -= 1.f;
+    return true;
+}
+
 void UUR_ChatComponent::Broadcast(const FString& Message, const int32 TeamIndex)
 {
     AUR_GameModeBase* GM = GetWorld()->GetAuthGameMode<AUR_GameModeBase>();
     if (GM)
     {
-        for (const auto& Recipient : GM->ChatComponents)
+        // Copied, Receive() overrides may invalidate the gamemode's sets
+        const TArray<TWeakObjectPtr<UUR_ChatComponent>> Recipients = GM->GetChatRecipients(this, TeamIndex);
+        for (const TWeakObjectPtr<UUR_ChatComponent>& Recipient : Recipients)
         {
-            if (Recipient->ShouldReceive(this, TeamIndex))
+            if (Recipient.IsValid())
             {
                 Recipient->Receive(this, Message, TeamIndex);
             }
@@ -146,15 +182,76 @@ bool UUR_ChatComponent::ShouldReceive_Implementation(UUR_ChatComponent* Sender,
 
 void UUR_ChatComponent::Receive_Implementation(UUR_ChatComponent* Sender, const FString& Message, int32 TeamIndex)
 {
-    FString SenderName = Sender ? Sender->GetOwnerName() : TEXT("");
     APlayerState* SenderPS = Sender ? Sender->GetPlayerState() : nullptr;
 
-    ClientReceive(SenderName, Message, TeamIndex, SenderPS);
+    if (IsLocalRecipient())
+    {
+        OnReceiveChatMessage.Broadcast(Sender ? Sender->GetOwnerName() : TEXT(""), Message, TeamIndex, SenderPS);
+        return;
+    }
+
+    // Remote recipient. Queue the message, everything received this frame goes out in a single RPC.
+    if (PendingMessages.Num() >= MaxPendingMessages)
+    {
+        PendingMessages.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+
+    FUR_ChatNetMessage& NetMessage = PendingMessages.AddDefaulted_GetRef();
+    NetMessage.Message = Message;
+    NetMessage.TeamIndex = TeamIndex;
+    if (SenderPS)
+    {
+        NetMessage.SenderPlayerId = SenderPS->GetPlayerId();
+    }
+    else
+    {
+        NetMessage.SenderName = Sender ? Sender->GetOwnerName() : TEXT("");
+    }
+
+    if (!bFlushScheduled)
+    {
+        bFlushScheduled = true;
+        GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::FlushPendingMessages);
+    }
+
+    // Server side listeners (eg. chat loggers) for remote recipients
+    if (OnReceiveChatMessage.IsBound())
+    {
+        OnReceiveChatMessage.Broadcast(Sender ? Sender->GetOwnerName() : TEXT(""), Message, TeamIndex, SenderPS);
+    }
+}
+
+void UUR_ChatComponent::OnOwnerTeamIndexChanged(AUR_PlayerState* PS, int32 OldTeamIndex, int32 NewTeamIndex)
+{
+    InvalidateChatRecipients();
+}
+
+void UUR_ChatComponent::OnOwnerTeamIdChanged(UObject* ObjectChangingTeam, int32 OldTeamID, int32 NewTeamID)
+{
+    InvalidateChatRecipients();
+}
+
+void UUR_ChatComponent::InvalidateChatRecipients() const
+{
+    if (AUR_GameModeBase* URGameMode = GetWorld()->GetAuthGameMode<AUR_GameModeBase>())
+    {
+        URGameMode->InvalidateChatRecipients();
+    }
+}
+
+bool UUR_ChatComponent::IsLocalRecipient() const
+{
+    return !GetIsReplicated() || GetNetMode() == NM_Standalone || !OwnerController || OwnerController->IsLocalController();
+}
+
+void UUR_ChatComponent::FlushPendingMessages()
+{
+    bFlushScheduled = false;
 
-    // ClientReceive triggers dispatcher on client side. Avoid triggering twice in standalone.
-    if (GetNetMode() != NM_Standalone)
+    if (PendingMessages.Num() > 0)
     {
-        OnReceiveChatMessage.Broadcast(SenderName, Message, TeamIndex, SenderPS);
+        ClientReceiveBatch(PendingMessages);
+        PendingMessages.Reset();
     }
 }
 
@@ -164,7 +261,7 @@ int32 UUR_ChatComponent::GetTeamIndex_Implementation()
     {
         if (PS->IsOnlyASpectator())
         {
-            CHAT_INDEX_SPEC;
+            return CHAT_INDEX_SPEC;
         }
         else
         {
@@ -187,13 +284,67 @@ APlayerState* UUR_ChatComponent::GetPlayerState_Implementation()
     return OwnerController ? OwnerController->PlayerState : nullptr;
 }
 
-void UUR_ChatComponent::ClientReceive_Implementation(const FString& SenderName, const FString& Message, int32 TeamIndex, APlayerState* SenderPS)
+void UUR_ChatComponent::ClientReceiveBatch_Implementation(const TArray<FUR_ChatNetMessage>& Messages)
+{
+    const AGameStateBase* GameState = GetWorld()->GetGameState();
+
+    for (const FUR_ChatNetMessage& NetMessage : Messages)
+    {
+        APlayerState* SenderPS = nullptr;
+        if (NetMessage.SenderPlayerId != INDEX_NONE && GameState)
+        {
+            for (APlayerState* PS : GameState->PlayerArray)
+            {
+                if (PS && PS->GetPlayerId() == NetMessage.SenderPlayerId)
+                {
+                    SenderPS = PS;
+                    break;
+                }
+            }
+        }
+
+        const FString& SenderName = SenderPS ? SenderPS->GetPlayerName() : NetMessage.SenderName;
+        OnReceiveChatMessage.Broadcast(SenderName, NetMessage.Message, NetMessage.TeamIndex, SenderPS);
+    }
+}
+
+bool FUR_ChatNetMessage::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
-    OnReceiveChatMessage.Broadcast(SenderName, Message, TeamIndex, SenderPS);
+    uint8 bHasPlayerSender = (SenderPlayerId != INDEX_NONE) ? 1 : 0;
+    Ar.SerializeBits(&bHasPlayerSender, 1);
+
+    if (bHasPlayerSender)
+    {
+        uint32 PackedPlayerId = static_cast<uint32>(SenderPlayerId);
+        Ar.SerializeIntPacked(PackedPlayerId);
+        SenderPlayerId = static_cast<int32>(PackedPlayerId);
+    }
+    else
+    {
+        SenderPlayerId = INDEX_NONE;
+        Ar << SenderName;
+    }
+
+    // Team indexes and channels (negative) all fit in a byte
+    int8 PackedTeamIndex = static_cast<int8>(TeamIndex);
+    Ar << PackedTeamIndex;
+    TeamIndex = PackedTeamIndex;
+
+    Ar << Message;
+
+    bOutSuccess = !Ar.IsError();
+    return true;
 }
 
 FString UUR_ChatComponent::ProcessChatParameters_Implementation(const FString& Original)
 {
+    // Most messages have no parameters at all
+    int32 ParamIndex;
+    if (!Original.FindChar(TEXT('%'), ParamIndex))
+    {
+        return Original;
+    }
+
     FString Result(Original);
 
     AUR_GameState* GameState = GetWorld()->GetGameState<AUR_GameState>();
@@ -14,6 +14,7 @@
 #define UE_API OPENTOURNAMENT_API
 
 class APlayerController;
+class AUR_PlayerState;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -56,6 +57,40 @@ class APlayerController;
 #define CHAT_INDEX_SPEC -2
 
 
+/**
+* Compact chat message as sent to clients.
+* Player senders are referenced by PlayerState ID and resolved on the receiving end,
+* only non-player senders carry their name.
+*/
+USTRUCT()
+struct FUR_ChatNetMessage
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Message;
+
+    UPROPERTY()
+    FString SenderName;
+
+    UPROPERTY()
+    int32 SenderPlayerId = INDEX_NONE;
+
+    UPROPERTY()
+    int32 TeamIndex = CHAT_INDEX_GLOBAL;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FUR_ChatNetMessage> : public TStructOpsTypeTraitsBase2<FUR_ChatNetMessage>
+{
+    enum
+    {
+        WithNetSerializer = true
+    };
+};
+
 /**
 * Event dispatcher for receiving a chat message.
 */
@@ -76,7 +111,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FReceiveChatMessageSignature, cons
 * - message is validated through Validate(), then sent to server via ServerSend()
 * - ServerSend() calls Send() (on server this time) which validates again, and forwards to Broadcast()
 * - Broadcast() iterates all registered chat components and calls Receive() when component ShouldReceive()
-* - Receive() then replicates through client RPC ClientReceive()
+* - Receive() then queues the message for client RPC ClientReceiveBatch(), once per frame
 *
 * For non-player entities you should set Replicates=false, specify FallbackOwnerName,
 * and adjust AntiSpamDelay sensibly.
@@ -128,6 +163,24 @@ public:
     UPROPERTY(BlueprintReadOnly)
     int32 MaxMessageLength;
 
+    /**
+    * Server-side rate limit, as a token bucket per sender.
+    * Each message costs one token. Tokens refill at RateLimitTokensPerSecond, up to RateLimitBurst.
+    * Unlike AntiSpamDelay this cannot be bypassed by a modified client.
+    */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float RateLimitBurst;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float RateLimitTokensPerSecond;
+
+    /**
+    * Max number of messages queued for this recipient within one frame.
+    * Oldest messages are dropped beyond that.
+    */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 MaxPendingMessages;
+
     /**
     * Event dispatcher for receiving a message.
     */
@@ -183,6 +236,9 @@ public:
 
     /**
     * Check whether this component should receive a broadcasted message.
+    * Evaluated when the gamemode (re)builds its recipient set for a sender and channel, not on every message.
+    * The set is rebuilt when the owner changes team or after ChatRecipientsMaxAge, other state changes
+    * should call AUR_GameModeBase::InvalidateChatRecipients.
     */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, BlueprintAuthorityOnly, Category = "Chat")
     bool ShouldReceive(UUR_ChatComponent* Sender, int32 TeamIndex);
@@ -194,12 +250,11 @@ public:
     void Receive(UUR_ChatComponent* Sender, const FString& Message, int32 TeamIndex);
 
     /**
-    * Client RPC to receive chat message.
-    * SenderName is the server-resolved name of message author.
-    * SenderPS is the player state of author if there is one. Might be null for non-player senders.
+    * Client RPC receiving all chat messages queued for this recipient during one server frame.
+    * Unreliable, a flood of chat cannot saturate the reliable buffer of the connection.
     */
-    UFUNCTION(Client, Reliable, BlueprintCallable, Category = "Chat")
-    virtual void ClientReceive(const FString& SenderName, const FString& Message, int32 TeamIndex, APlayerState* SenderPS);
+    UFUNCTION(Client, Unreliable)
+    void ClientReceiveBatch(const TArray<FUR_ChatNetMessage>& Messages);
 
     /**
     * Process parameters in chat messages.
@@ -218,6 +273,33 @@ public:
     */
     UFUNCTION(BlueprintPure, Category = "Chat", Meta = (WorldContext = "WorldContextObject"))
     static FColor GetChatMessageColor(UObject* WorldContextObject, int32 TeamIndex);
+
+protected:
+    /**
+    * Takes one token from the rate limit bucket, returns false if the sender is over its rate.
+    */
+    bool ConsumeRateLimitToken();
+
+    /**
+    * Whether messages for this component are dispatched locally rather than through ClientReceiveBatch.
+    */
+    bool IsLocalRecipient() const;
+
+    void FlushPendingMessages();
+
+    UFUNCTION()
+    void OnOwnerTeamIndexChanged(AUR_PlayerState* PS, int32 OldTeamIndex, int32 NewTeamIndex);
+
+    UFUNCTION()
+    void OnOwnerTeamIdChanged(UObject* ObjectChangingTeam, int32 OldTeamID, int32 NewTeamID);
+
+    void InvalidateChatRecipients() const;
+
+    float RateLimitTokens;
+    double RateLimitLastRefillTime;
+
+    TArray<FUR_ChatNetMessage> PendingMessages;
+    bool bFlushScheduled;
 };
 
 #undef UE_API
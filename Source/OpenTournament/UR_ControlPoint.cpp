@@ -6,6 +6,7 @@
 
 #include "Components/ChildActorComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
 
 #include "OpenTournament.h"
 #include "UR_Character.h"
@@ -24,11 +25,17 @@ AUR_ControlPoint::AUR_ControlPoint(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , bRequiredTagsExact(false)
     , bExcludedTagsExact(true)
+    , ControllingTeam(INDEX_NONE)
 {
     // Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
     PrimaryActorTick.bCanEverTick = false;
     PrimaryActorTick.bStartWithTickEnabled = false;
 
+    // Replicates the Zone counts, the Zone itself is a non-replicated child actor spawned on every machine
+    bReplicates = true;
+    SetReplicatingMovement(false);
+    SetNetUpdateFrequency(1.f);
+
     TriggerZoneComponent = CreateDefaultSubobject<UChildActorComponent>(TEXT("TriggerZoneComponent"));
     if (TriggerZoneClass)
     {
@@ -46,12 +53,21 @@ AUR_ControlPoint::AUR_ControlPoint(const FObjectInitializer& ObjectInitializer)
     }
 }
 
+void AUR_ControlPoint::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ThisClass, TeamOccupancy);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 void AUR_ControlPoint::PostInitializeComponents()
 {
     Super::PostInitializeComponents();
 
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+
     // Ensure that TriggerZone pointer is set with our ChildActor
     TriggerZone = Cast<AUR_TriggerZone>(TriggerZoneComponent->GetChildActor());
 
@@ -59,9 +75,22 @@ void AUR_ControlPoint::PostInitializeComponents()
     {
         TriggerZone->OnActorEnter.AddUniqueDynamic(this, &ThisClass::ActorEnter);
         TriggerZone->OnActorExit.AddUniqueDynamic(this, &ThisClass::OnActorExit);
+        TriggerZone->OnOccupancyChanged.AddUniqueDynamic(this, &ThisClass::OnZoneOccupancyChanged);
+
+        ensureMsgf(!TriggerZone->GetIsReplicated(), TEXT("ControlPoint (%s) TriggerZone must not replicate, its counts are replicated by the ControlPoint"), *GetName());
     }
 }
 
+void AUR_ControlPoint::SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    ExcludedTags = InExcludedTags;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 void AUR_ControlPoint::ActorEnter(AActor* InActor)
@@ -76,11 +105,10 @@ void AUR_ControlPoint::ActorEnter(AActor* InActor)
 
 void AUR_ControlPoint::OnActorEnter_Implementation(AActor* InActor)
 {
-    SetPointContestedState(ShouldPointBeContested(EControlPointEvent::Entering, InActor));
-
-    if (!IsPointContested())
+    // Clients update from the replicated counts instead, see OnRep_TeamOccupancy
+    if (HasAuthority())
     {
-        SetPointControlState(true, InActor);
+        UpdatePointState(EControlPointEvent::Entering, InActor);
     }
 }
 
@@ -96,40 +124,81 @@ void AUR_ControlPoint::ActorExit(AActor* InActor)
 
 void AUR_ControlPoint::OnActorExit_Implementation(AActor* InActor)
 {
-    SetPointContestedState(ShouldPointBeContested(EControlPointEvent::Exiting, InActor));
+    if (HasAuthority())
+    {
+        UpdatePointState(EControlPointEvent::Exiting, InActor);
+    }
+}
+
+void AUR_ControlPoint::OnZoneOccupancyChanged()
+{
+    if (HasAuthority() && TriggerZone)
+    {
+        TeamOccupancy = TriggerZone->GetTeamOccupancyCounts();
+        ForceNetUpdate();
+    }
+}
+
+void AUR_ControlPoint::OnRep_TeamOccupancy()
+{
+    if (TriggerZone)
+    {
+        const int32 OldNumOccupants = TriggerZone->GetNumOccupants();
+        TriggerZone->SetTeamOccupancy(TeamOccupancy);
+
+        const EControlPointEvent EventType = TriggerZone->GetNumOccupants() >= OldNumOccupants ? EControlPointEvent::Entering : EControlPointEvent::Exiting;
+        UpdatePointState(EventType, nullptr);
+    }
+}
+
+void AUR_ControlPoint::UpdatePointState(EControlPointEvent EventType, AActor* InActor)
+{
+    // The Zone counts already include the entering or exiting Actor
+    const bool bShouldBeContested = ShouldPointBeContested(EventType, InActor);
+    if (bShouldBeContested != IsPointContested())
+    {
+        SetPointContestedState(bShouldBeContested, InActor);
+    }
+
+    // A single Team holding the Zone takes control of the Point, and keeps it once the Zone empties
+    const int32 OccupyingTeam = GetOccupyingTeam();
+    if (!bShouldBeContested && OccupyingTeam != INDEX_NONE && OccupyingTeam != ControllingTeam)
+    {
+        AActor* ControllingActor = (EventType == EControlPointEvent::Entering && InActor) ? InActor : TriggerZone->FindOccupantOfTeam(OccupyingTeam);
+        if (ControllingTeam != INDEX_NONE)
+        {
+            SetPointControlState(false, ControllingActor);
+        }
+
+        ControllingTeam = OccupyingTeam;
+        SetPointControlState(true, ControllingActor);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool AUR_ControlPoint::ShouldPointBeContested_Implementation(EControlPointEvent EventType, const AActor* TargetActor) const
 {
-    // Default implementation does not allow for Contested state
-    return false;
+    return IsZoneOccupiedByMultipleTeams();
 }
 
 void AUR_ControlPoint::SetPointContestedState(bool bShouldBeContested, AActor* InActor)
 {
-    FGameplayTagContainer PointTags;
-    GetOwnedGameplayTags(PointTags);
-
     if (bShouldBeContested)
     {
-        PointTags.AddTag(ContestedTag);
+        GameplayTags.AddTag(ContestedTag);
         OnPointContested(InActor);
     }
     else
     {
-        PointTags.RemoveTag(ContestedTag);
+        GameplayTags.RemoveTag(ContestedTag);
         OnPointUncontested(InActor);
     }
 }
 
 bool AUR_ControlPoint::IsPointContested() const
 {
-    FGameplayTagContainer PointTags;
-    GetOwnedGameplayTags(PointTags);
-
-    return PointTags.HasTagExact(ContestedTag);
+    return GameplayTags.HasTagExact(ContestedTag);
 }
 
 void AUR_ControlPoint::OnPointContested_Implementation(AActor* TargetActor)
@@ -152,34 +221,29 @@ bool AUR_ControlPoint::IsPermittedToControl_Implementation(const AActor* TargetA
         return false;
     }
 
-    // Check if the actor being teleported has any Required or Excluded GameplayTags
-    FGameplayTagContainer TargetTags;
-
-    if (auto TagActor = Cast<IGameplayTagAssetInterface>(TargetActor))
+    // Check if the actor has any Required or Excluded GameplayTags, untagged actors are tested as having none
+    if (Cast<IGameplayTagAssetInterface>(TargetActor) == nullptr)
     {
-        TagActor->GetOwnedGameplayTags(TargetTags);
+        return IsPermittedByGameplayTags(FGameplayTagContainer::EmptyContainer);
     }
 
-    return IsPermittedByGameplayTags(TargetTags);
+    return TagRequirementQuery.IsActorPermitted(TargetActor);
 }
 
 void AUR_ControlPoint::SetPointControlState(bool bShouldBeControlled, AActor* InActor)
 {
-    FGameplayTagContainer PointTags;
-    GetOwnedGameplayTags(PointTags);
-
     if (bShouldBeControlled)
     {
         ActorControlTag = GetActorControlTag(InActor);
-        PointTags.AddTag(ActorControlTag);
-        PointTags.AddTag(ControlTag);
+        GameplayTags.AddTag(ActorControlTag);
+        GameplayTags.AddTag(ControlTag);
 
         OnPointControlled(InActor);
     }
     else
     {
-        PointTags.RemoveTag(ActorControlTag);
-        PointTags.RemoveTag(ControlTag);
+        GameplayTags.RemoveTag(ActorControlTag);
+        GameplayTags.RemoveTag(ControlTag);
 
         OnPointUncontrolled(InActor);
     }
@@ -199,38 +263,27 @@ void AUR_ControlPoint::OnPointUncontrolled_Implementation(AActor* InActor)
 
 bool AUR_ControlPoint::IsZoneOccupied() const
 {
-    bool IsOccupied{ false };
-
-    if (TriggerZone)
-    {
-        IsOccupied = TriggerZone->TriggerActors.Num() > 0;
-    }
-
-    return IsOccupied;
+    return TriggerZone && TriggerZone->GetNumOccupants() > 0;
 }
 
 bool AUR_ControlPoint::IsActorInZone(AActor* InActor) const
 {
-    bool IsInZone{ false };
+    return TriggerZone && TriggerZone->IsOccupant(InActor);
+}
 
-    if (TriggerZone)
-    {
-        IsInZone = TriggerZone->TriggerActors.Find(InActor) != INDEX_NONE;
-    }
+bool AUR_ControlPoint::IsZoneOccupiedByMultipleTeams() const
+{
+    return TriggerZone && TriggerZone->GetNumOccupyingTeams() > 1;
+}
 
-    return IsInZone;
+int32 AUR_ControlPoint::GetOccupyingTeam() const
+{
+    return TriggerZone ? TriggerZone->GetSoleOccupyingTeam() : INDEX_NONE;
 }
 
 bool AUR_ControlPoint::IsPermittedByGameplayTags(const FGameplayTagContainer& TargetTags) const
 {
-    if (RequiredTags.Num() == 0 || (bRequiredTagsExact && TargetTags.HasAnyExact(RequiredTags)) || (!bRequiredTagsExact && TargetTags.HasAny(RequiredTags)))
-    {
-        return (ExcludedTags.Num() == 0 || (bExcludedTagsExact && !TargetTags.HasAnyExact(ExcludedTags)) || (!bExcludedTagsExact && TargetTags.HasAny(RequiredTags)));
-    }
-    else
-    {
-        return false;
-    }
+    return TagRequirementQuery.Matches(TargetTags);
 }
 
 FGameplayTag AUR_ControlPoint::GetActorControlTag(const AActor* InActor) const
@@ -7,6 +7,8 @@
 #include "GameFramework/Actor.h"
 #include "GameplayTagAssetInterface.h"
 
+#include "GAS/UR_GameplayTagRequirementQuery.h"
+
 #include "Enums/UR_ControlPointEnumerations.h"
 
 #include "UR_ControlPoint.generated.h"
@@ -61,6 +63,8 @@ public:
 
     AUR_ControlPoint(const FObjectInitializer& ObjectInitializer);
 
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
     /**
     * Find our ShapeComponent if we don't have it set, and set up Event Bindings
     */
@@ -93,7 +97,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
     /**
-    * Should the Point be Contested?
+    * Should the Point be Contested? By default, while Actors of more than one Team occupy the Zone.
     */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "ControlPoint")
     bool ShouldPointBeContested(EControlPointEvent EventType, const AActor* TargetActor) const;
@@ -148,6 +152,12 @@ public:
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "ControlPoint")
     void OnPointUncontrolled(AActor* InActor);
 
+    /**
+    * Team in control of the Point, INDEX_NONE if no Team took it yet
+    */
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "ControlPoint")
+    int32 ControllingTeam;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -162,6 +172,18 @@ public:
     UFUNCTION(BlueprintPure, BlueprintCallable, Category = "ControlPoint")
     bool IsActorInZone(AActor* InActor) const;
 
+    /**
+    * Do Actors of more than one Team occupy the Zone?
+    */
+    UFUNCTION(BlueprintPure, BlueprintCallable, Category = "ControlPoint")
+    bool IsZoneOccupiedByMultipleTeams() const;
+
+    /**
+    * The only Team occupying the Zone, INDEX_NONE if empty or shared
+    */
+    UFUNCTION(BlueprintPure, BlueprintCallable, Category = "ControlPoint")
+    int32 GetOccupyingTeam() const;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Gameplay Tags
 
@@ -176,30 +198,41 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
     FGameplayTagContainer GameplayTags;
 
+    /**
+    * Set the Required / Excluded tags at runtime, and recompile the tag requirements
+    */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+    void SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
     /**
     * Are RequiredTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bRequiredTagsExact;
 
     /**
     * Actors attempting to Teleport must have at least one exact Tag match
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer RequiredTags;
 
     /**
     * Are ExcludedTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bExcludedTagsExact;
 
     /**
     * Gameplay Tags for this Actor
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer ExcludedTags;
 
+    /**
+    * RequiredTags / ExcludedTags compiled in PostInitializeComponents and SetTagRequirements
+    */
+    FUR_GameplayTagRequirementQuery TagRequirementQuery;
+
     /**
     * Is this actor permitted to control or contest given its associated GameplayTags?
     */
@@ -244,4 +277,23 @@ public:
 #if WITH_EDITOR
     virtual bool CanEditChange(const FProperty* InProperty) const override;
 #endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+    * Per-Team counts of the server's Zone, pushed to the local Zone of clients
+    */
+    UPROPERTY(ReplicatedUsing = OnRep_TeamOccupancy)
+    TArray<uint8> TeamOccupancy;
+
+    UFUNCTION()
+    void OnRep_TeamOccupancy();
+
+    UFUNCTION()
+    void OnZoneOccupancyChanged();
+
+    /**
+    * Updates the Contested and Controlled states from the Zone's per-Team counts
+    */
+    void UpdatePointState(EControlPointEvent EventType, AActor* InActor);
 };
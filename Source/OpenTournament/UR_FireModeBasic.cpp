@@ -4,6 +4,9 @@
 
 #include "UR_FireModeBasic.h"
 
+#include "Engine/NetConnection.h"
+#include "Engine/NetSerialization.h"
+#include "Engine/PackageMapClient.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "UR_LogChannels.h"
@@ -12,6 +15,45 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool FHitscanVisualInfo::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << Seed;
+
+    // Recording and playback both go through the demo driver's replay connection
+    UPackageMapClient* MapClient = Cast<UPackageMapClient>(Map);
+    const UNetConnection* Connection = MapClient ? MapClient->GetConnection() : nullptr;
+    if (!Connection || !Connection->IsReplay())
+    {
+        Ar << Vectors;
+        bOutSuccess = !Ar.IsError();
+        return true;
+    }
+
+    static constexpr uint32 MaxReplayVectors = 16 * 1024;
+
+    uint32 NumVectors = Vectors.Num();
+    Ar.SerializeIntPacked(NumVectors);
+    if (Ar.IsLoading())
+    {
+        if (NumVectors > MaxReplayVectors)
+        {
+            Ar.SetError();
+            bOutSuccess = false;
+            return false;
+        }
+        Vectors.SetNum(NumVectors);
+    }
+
+    bOutSuccess = true;
+    for (FVector& Vector : Vectors)
+    {
+        bOutSuccess &= SerializePackedVector<100, 30>(Vector, Ar);
+    }
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 void UUR_FireModeBasic::StartFire_Implementation()
 {
     if (!bRequestedFire)
@@ -16,6 +16,7 @@
 
 class AUR_Projectile;
 class IUR_FireModeBasicInterface;
+class UPackageMap;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,6 +56,9 @@ struct FSimulatedShotInfo
 *
 * Intentionally also generic to support many sorts of hitscan implementations.
 * eg. bouncing beam, seeded shotgun
+*
+* Game connections receive it at full precision. Replays record every vector quantized to 0.01 (within
+* +/- 10 million units per component), whatever it holds, as playback only needs it for visuals.
 */
 USTRUCT(BlueprintType)
 struct FHitscanVisualInfo
@@ -71,6 +75,17 @@ struct FHitscanVisualInfo
         : Seed(0)
     {
     }
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FHitscanVisualInfo> : public TStructOpsTypeTraitsBase2<FHitscanVisualInfo>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
 };
 
 
@@ -8,6 +8,7 @@
 #include "TimerManager.h"
 
 #include "UR_FunctionLibrary.h"
+#include "Weapons/UR_ContinuousFireSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_FireModeContinuous)
 
@@ -32,8 +33,14 @@ void UUR_FireModeContinuous::RequestStartFire_Implementation()
 void UUR_FireModeContinuous::StartFire_Implementation()
 {
     DeltaTimeAccumulator = 0.f;
+    bHasLatestBeamHit = false;
     SetComponentTickEnabled(true);
 
+    if (UUR_ContinuousFireSubsystem* ContinuousFireSubsystem = UWorld::GetSubsystem<UUR_ContinuousFireSubsystem>(GetWorld()))
+    {
+        ContinuousFireSubsystem->RegisterFireMode(this);
+    }
+
     if (ContinuousInterface)
     {
         if (GetNetMode() != NM_DedicatedServer)
@@ -57,6 +64,11 @@ void UUR_FireModeContinuous::SpinDown()
 {
     SetComponentTickEnabled(false);
 
+    if (UUR_ContinuousFireSubsystem* ContinuousFireSubsystem = UWorld::GetSubsystem<UUR_ContinuousFireSubsystem>(GetWorld()))
+    {
+        ContinuousFireSubsystem->UnregisterFireMode(this);
+    }
+
     if (ContinuousInterface)
     {
         if (GetNetMode() != NM_DedicatedServer)
@@ -90,34 +102,55 @@ float UUR_FireModeContinuous::GetTimeUntilIdle_Implementation()
     return 0.f;
 }
 
-void UUR_FireModeContinuous::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+int32 UUR_FireModeContinuous::AdvanceHitCheckClock(float DeltaTime, int32 MaxSteps)
 {
-    // Hit check first, on controlling client or authority
-    if (UUR_FunctionLibrary::IsComponentLocallyControlled(this) || GetOwnerRole() == ROLE_Authority)
+    if (HitCheckInterval <= 0.f)
     {
-        DeltaTimeAccumulator += DeltaTime;
+        return 1;
+    }
 
-        //NOTE: allow a minor negative margin to improve the accuracy of intervals
-        if (DeltaTimeAccumulator >= HitCheckInterval - 0.2f * DeltaTime)
-        {
-            if (ContinuousInterface)
-            {
-                if (UUR_FunctionLibrary::IsComponentLocallyControlled(this))
-                {
-                    IUR_FireModeContinuousInterface::Execute_SimulateContinuousHitCheck(ContinuousInterface.GetObject(), this);
-                }
-                if (GetOwnerRole() == ROLE_Authority)
-                {
-                    IUR_FireModeContinuousInterface::Execute_AuthorityContinuousHitCheck(ContinuousInterface.GetObject(), this);
-                }
-            }
-
-            // If we had a high frametime hitch, allow up to two ticks in a row to do a hit check, but never more
-            DeltaTimeAccumulator = FMath::Min(DeltaTimeAccumulator - HitCheckInterval, HitCheckInterval);
-        }
+    DeltaTimeAccumulator += DeltaTime;
+
+    const int32 NumSteps = FMath::Min(FMath::FloorToInt32(DeltaTimeAccumulator / HitCheckInterval), MaxSteps);
+    DeltaTimeAccumulator -= NumSteps * HitCheckInterval;
+
+    // After a long hitch, drop what is left rather than bursting damage over the next frames, but keep the phase
+    if (DeltaTimeAccumulator >= HitCheckInterval)
+    {
+        DeltaTimeAccumulator = FMath::Fmod(DeltaTimeAccumulator, HitCheckInterval);
     }
 
-    // Visuals second, on all clients
+    return NumSteps;
+}
+
+void UUR_FireModeContinuous::HitCheckStep()
+{
+    if (!ContinuousInterface)
+    {
+        return;
+    }
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        IUR_FireModeContinuousInterface::Execute_AuthorityContinuousHitCheck(ContinuousInterface.GetObject(), this);
+    }
+
+    // Authority may have stopped firing (out of ammo)
+    if (!IsComponentTickEnabled())
+    {
+        return;
+    }
+
+    // Owner client predicts, other clients simulate the beam
+    if (GetNetMode() != NM_DedicatedServer)
+    {
+        IUR_FireModeContinuousInterface::Execute_SimulateContinuousHitCheck(ContinuousInterface.GetObject(), this);
+    }
+}
+
+void UUR_FireModeContinuous::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    // Hit checks run on the fixed clock of UUR_ContinuousFireSubsystem, only visuals here, on all clients
     if (ContinuousInterface && GetNetMode() != NM_DedicatedServer)
     {
         IUR_FireModeContinuousInterface::Execute_UpdateContinuousEffects(ContinuousInterface.GetObject(), this, DeltaTime);
@@ -88,6 +88,7 @@ public:
         PrimaryComponentTick.bStartWithTickEnabled = false;
 
         HitCheckInterval = 0.050f;
+        bHasLatestBeamHit = false;
 
         TraceDistance = 1000;
         AmmoCostPerSecond = 1.f;
@@ -97,7 +98,7 @@ public:
 
     /**
     * Behaves like TickInterval but controls the rate of the ContinuousHitCheck callbacks.
-    * This should be set to a fixed value so DPS does not depend on framerate.
+    * Hit checks run on a fixed clock (see UUR_ContinuousFireSubsystem) so DPS does not depend on framerate.
     *
     * The reason we do not use TickInterval is because you still need a "real" tick to update visuals,
     * which is what the PlayContinuousEffects callback is for.
@@ -148,6 +149,16 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = "Content|Runtime")
     float AmmoCostAccumulator;
 
+    /**
+    * Result of the latest hit check (authoritative on server, simulated on clients).
+    * Beam visuals are placed from it every frame instead of tracing again.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "Content|Runtime")
+    FHitResult LatestBeamHit;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Content|Runtime")
+    bool bHasLatestBeamHit;
+
 public:
     UPROPERTY(BlueprintReadOnly)
     TScriptInterface<IUR_FireModeContinuousInterface> ContinuousInterface;
@@ -168,6 +179,15 @@ public:
 
     virtual float GetTimeUntilIdle_Implementation() override;
 
+    /**
+    * Advance the hit check clock by DeltaTime, keeping the remainder for next frame.
+    * Returns the number of hit checks due, at most MaxSteps.
+    */
+    int32 AdvanceHitCheckClock(float DeltaTime, int32 MaxSteps);
+
+    /** Run one hit check, called by UUR_ContinuousFireSubsystem while firing */
+    void HitCheckStep();
+
 protected:
     /*
     virtual void BeginPlay() override
@@ -196,7 +216,8 @@ class OPENTOURNAMENT_API IUR_FireModeContinuousInterface : public IUR_FireModeBa
 
 public:
     /**
-    * Called every HitCheck "tick" (according to HitCheckInterval) on owner client.
+    * Called every HitCheck "tick" (according to HitCheckInterval) on owner client,
+    * and on other clients so they can update the beam from a simulated hit.
     */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable)
     void SimulateContinuousHitCheck(UUR_FireModeContinuous* FireMode);
@@ -4,6 +4,42 @@
 
 #include "UR_GameSession.h"
 
+#include <Engine/Engine.h>
+#include <Kismet/GameplayStatics.h>
+
+#include "GameModes/UR_ExperienceDefinition.h"
+#include "GameModes/UR_ExperienceManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_GameSession)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AUR_GameSession::InitOptions(const FString& Options)
+{
+    Super::InitOptions(Options);
+
+    if (UGameplayStatics::HasOption(Options, TEXT("NextExperience")))
+    {
+        // Same format as the Experience option
+        const FString ExperienceName = UGameplayStatics::ParseOption(Options, TEXT("NextExperience"));
+        NextExperienceId = FPrimaryAssetId(FPrimaryAssetType(UUR_ExperienceDefinition::StaticClass()->GetFName()), FName(*ExperienceName));
+    }
+}
+
+void AUR_GameSession::HandleMatchHasStarted()
+{
+    Super::HandleMatchHasStarted();
+
+    if (NextExperienceId.IsValid())
+    {
+        PrefetchNextExperience(NextExperienceId);
+    }
+}
+
+void AUR_GameSession::PrefetchNextExperience(FPrimaryAssetId ExperienceId)
+{
+    if (UUR_ExperienceManager* ExperienceManager = GEngine->GetEngineSubsystem<UUR_ExperienceManager>())
+    {
+        ExperienceManager->PrefetchExperience(ExperienceId, GetNetMode());
+    }
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <GameFramework/GameSession.h>
+#include <UObject/PrimaryAssetId.h>
 
 #include "UR_GameSession.generated.h"
 
@@ -20,5 +21,24 @@ class OPENTOURNAMENT_API AUR_GameSession
 {
     GENERATED_BODY()
 
+public:
+    virtual void InitOptions(const FString& Options) override;
+
+    virtual void HandleMatchHasStarted() override;
+
+    /**
+     * Starts streaming the experience of the next match in the rotation while the current one is still running.
+     * Its bundles and game feature plugins are kept warm across travel and reused once the next map sets it.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "GameSession")
+    void PrefetchNextExperience(FPrimaryAssetId ExperienceId);
+
+    /**
+     * Experience of the next match, from the NextExperience URL option.
+     * Prefetched once the current match has started, so it does not compete with the current experience loading.
+     */
+    UPROPERTY(BlueprintReadWrite, Category = "GameSession")
+    FPrimaryAssetId NextExperienceId;
+
     // @! TODO
 };
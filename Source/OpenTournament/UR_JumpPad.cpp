@@ -20,7 +20,9 @@
 #include "OpenTournament.h"
 #include "UR_Character.h"
 #include "UR_LogChannels.h"
+#include "Character/UR_CharacterMovementComponent.h"
 #include "AI/UR_NavigationUtilities.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #if WITH_EDITOR
 #include "Components/SplineComponent.h"
@@ -95,10 +97,29 @@ void AUR_JumpPad::OnConstruction(const FTransform& Transform)
     NavLink->Links[0].Right = Destination.GetLocation();
 }
 
+void AUR_JumpPad::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_JumpPad::SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    ExcludedTags = InExcludedTags;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
 void AUR_JumpPad::BeginPlay()
 {
     Super::BeginPlay();
 
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
     InitializeDynamicMaterialInstance();
 
 #if WITH_EDITOR
@@ -106,6 +127,13 @@ void AUR_JumpPad::BeginPlay()
 #endif
 }
 
+void AUR_JumpPad::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AUR_JumpPad::OnTriggerEnter(UPrimitiveComponent* HitComp, AActor* Other, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
     ACharacter* TargetCharacter{ Cast<ACharacter>(Other) };
@@ -116,13 +144,36 @@ void AUR_JumpPad::OnTriggerEnter(UPrimitiveComponent* HitComp, AActor* Other, UP
         {
             GAME_LOG(LogGame, Log, "Entered JumpPad (%s)", *GetName());
 
-            TargetCharacter->LaunchCharacter(CalculateJumpVelocity(TargetCharacter), !bRetainHorizontalVelocity, true);
-            PlayJumpPadEffects();
-            UUR_NavigationUtilities::ForceReachedDestinationWithin(TargetCharacter, HitComp->GetNavigationBounds());
+            // Launch from inside the next move so the launch is predicted and replayed like any other movement
+            if (UUR_CharacterMovementComponent* URMovement = Cast<UUR_CharacterMovementComponent>(TargetCharacter->GetCharacterMovement()))
+            {
+                URMovement->RequestJumpPadLaunch(this);
+            }
+            else
+            {
+                LaunchCharacter(TargetCharacter);
+            }
         }
     }
 }
 
+void AUR_JumpPad::LaunchCharacter(ACharacter* TargetCharacter)
+{
+    if (TargetCharacter == nullptr)
+    {
+        return;
+    }
+
+    TargetCharacter->LaunchCharacter(CalculateJumpVelocity(TargetCharacter), !bRetainHorizontalVelocity, true);
+
+    // Moves replayed after a correction launch again, but must not repeat effects
+    if (!TargetCharacter->bClientUpdating)
+    {
+        PlayJumpPadEffects();
+        UUR_NavigationUtilities::ForceReachedDestinationWithin(TargetCharacter, CapsuleComponent->GetNavigationBounds());
+    }
+}
+
 void AUR_JumpPad::PlayJumpPadEffects_Implementation()
 {
     if (JumpPadLaunchSound)
@@ -143,24 +194,13 @@ bool AUR_JumpPad::IsPermittedToJump_Implementation(const AActor* TargetActor) co
         return false;
     }
 
-    if (const auto TagActor = Cast<IGameplayTagAssetInterface>(TargetActor))
-    {
-        // Check if the actor using the Teleporter has any Required or Excluded GameplayTags
-        FGameplayTagContainer TargetTags;
-        TagActor->GetOwnedGameplayTags(TargetTags);
-        return IsPermittedByGameplayTags(TargetTags);
-    }
-
-    return true;
+    // Check if the actor using the JumpPad has any Required or Excluded GameplayTags
+    return TagRequirementQuery.IsActorPermitted(TargetActor);
 }
 
 bool AUR_JumpPad::IsPermittedByGameplayTags(const FGameplayTagContainer& TargetTags) const
 {
-    if (RequiredTags.Num() == 0 || (bRequiredTagsExact && TargetTags.HasAnyExact(RequiredTags)) || (!bRequiredTagsExact && TargetTags.HasAny(RequiredTags)))
-    {
-        return (ExcludedTags.Num() == 0 || (bExcludedTagsExact && !TargetTags.HasAnyExact(ExcludedTags)) || (!bExcludedTagsExact && TargetTags.HasAny(RequiredTags)));
-    }
-    return false;
+    return TagRequirementQuery.Matches(TargetTags);
 }
 
 FVector AUR_JumpPad::CalculateJumpVelocity(const AActor* InCharacter) const
@@ -8,10 +8,13 @@
 #include "GameplayTagAssetInterface.h"
 #include "GameFramework/Actor.h"
 
+#include "GAS/UR_GameplayTagRequirementQuery.h"
+
 #include "UR_JumpPad.generated.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+class ACharacter;
 class UAudioComponent;
 class UCapsuleComponent;
 class UMaterialInstanceDynamic;
@@ -146,8 +149,12 @@ public:
 
     virtual void OnConstruction(const FTransform& Transform) override;
 
+    virtual void PostInitializeComponents() override;
+
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -156,6 +163,12 @@ public:
     UFUNCTION()
     void OnTriggerEnter(class UPrimitiveComponent* HitComp, class AActor* Other, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+    /**
+    * Launch the character towards our Destination.
+    * Characters using UUR_CharacterMovementComponent get here from inside a move (see RequestJumpPadLaunch).
+    */
+    void LaunchCharacter(ACharacter* TargetCharacter);
+
     /**
     * Is this actor permitted to jump?
     */
@@ -207,30 +220,41 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
     FGameplayTagContainer GameplayTags;
 
+    /**
+    * Set the Required / Excluded tags at runtime, and recompile the tag requirements
+    */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+    void SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
     /**
     * Are RequiredTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bRequiredTagsExact;
 
     /**
     * Actors attempting to Teleport must have at least one exact Tag match
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer RequiredTags;
 
     /**
     * Are ExcludedTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bExcludedTagsExact;
 
     /**
     * Gameplay Tags for this Actor
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer ExcludedTags;
 
+    /**
+    * RequiredTags / ExcludedTags compiled in PostInitializeComponents and SetTagRequirements
+    */
+    FUR_GameplayTagRequirementQuery TagRequirementQuery;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Dynamic MaterialInstance
 
@@ -4,15 +4,21 @@
 
 #include "UR_Lift.h"
 
-#include "TimerManager.h"
 #include "Components/AudioComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "Curves/CurveFloat.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
 
 #include "OpenTournament.h"
 #include "UR_LogChannels.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_Lift)
 
@@ -25,9 +31,12 @@ AUR_Lift::AUR_Lift(const FObjectInitializer& ObjectInitializer)
     , EndRelativeLocation(FVector(0.f, 0.f, 100.f))
     , EaseIn(true)
     , EaseOut(true)
+    , TravelCurve(nullptr)
     , LiftStartSound(nullptr)
     , LiftMovingSound(nullptr)
     , LiftEndSound(nullptr)
+    , LiftState(ELiftState::Start)
+    , CycleStartTime(-1.0)
 {
     BoxComponent = CreateDefaultSubobject<UBoxComponent>(TEXT("BoxComponent"));
     BoxComponent->SetBoxExtent(FVector(50, 50, 30));
@@ -43,6 +52,23 @@ AUR_Lift::AUR_Lift(const FObjectInitializer& ObjectInitializer)
     AudioComponent->SetupAttachment(RootComponent);
 
     EndRelativeLocation = RootComponent->GetComponentLocation() + FVector::UpVector * 100;
+
+    // Only ticks while a cycle is running, before riders so based movement sees this frame's position
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
+
+    // Clients derive the position from CycleStartTime
+    bReplicates = true;
+    SetReplicatingMovement(false);
+    SetNetUpdateFrequency(1.f);
+}
+
+void AUR_Lift::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ThisClass, CycleStartTime);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,7 +77,29 @@ void AUR_Lift::BeginPlay()
 {
     Super::BeginPlay();
 
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
     StartLocation = RootComponent->GetComponentLocation();
+
+    // Late joiners may receive a cycle that is still running
+    if (CycleStartTime >= 0.0)
+    {
+        StartLiftCycle(CycleStartTime);
+    }
+}
+
+void AUR_Lift::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AUR_Lift::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UpdateLift(GetLiftTime(), DeltaTime);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,12 +108,23 @@ void AUR_Lift::OnTriggerEnter(UPrimitiveComponent* HitComp, AActor* Other, UPrim
 {
     if (bIsTriggered == false && LiftState == ELiftState::Start)
     {
-        MoveToEndPosition();
+        // Clients start immediately for a locally controlled rider, the server's start time replaces the prediction
+        const APawn* Pawn = Cast<APawn>(Other);
+        if (HasAuthority() || (Pawn && Pawn->IsLocallyControlled()))
+        {
+            StartLiftCycle(GetLiftTime());
+        }
     }
 
     bIsTriggered = true;
     ActorsOnTrigger.AddUnique(Other);
 
+    // Move riders after the lift so they ride this frame's lift position
+    if (const ACharacter* Character = Cast<ACharacter>(Other); Character && Character->GetCharacterMovement())
+    {
+        Character->GetCharacterMovement()->AddTickPrerequisiteActor(this);
+    }
+
     GAME_LOG(LogGame, Log, "Entered Lift (%s) Trigger Region", *GetName());
 }
 
@@ -74,6 +133,11 @@ void AUR_Lift::OnTriggerExit(UPrimitiveComponent* HitComp, AActor* Other, UPrimi
     ActorsOnTrigger.Remove(Other);
     bIsTriggered = ActorsOnTrigger.Num() > 0;
 
+    if (const ACharacter* Character = Cast<ACharacter>(Other); Character && Character->GetCharacterMovement())
+    {
+        Character->GetCharacterMovement()->RemoveTickPrerequisiteActor(this);
+    }
+
     GAME_LOG(LogGame, Log, "Exited Lift (%s) Trigger Region", *GetName());
 
     if (bIsTriggered)
@@ -82,25 +146,163 @@ void AUR_Lift::OnTriggerExit(UPrimitiveComponent* HitComp, AActor* Other, UPrimi
     }
 }
 
-void AUR_Lift::MoveToStartPosition()
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+double AUR_Lift::GetLiftTime() const
+{
+    const UWorld* World = GetWorld();
+    if (const AGameStateBase* GameState = World ? World->GetGameState() : nullptr)
+    {
+        return GameState->GetServerWorldTimeSeconds();
+    }
+
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void AUR_Lift::SampleLiftAtTime(double LiftTime)
+{
+    if (!bSampled)
+    {
+        PreSampleLocation = RootComponent->GetComponentLocation();
+        PreSampleVelocity = RootComponent->ComponentVelocity;
+        bSampled = true;
+    }
+
+    RootComponent->SetWorldLocation(GetLiftLocationAtTime(LiftTime), false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+void AUR_Lift::RestoreSampledLift()
+{
+    if (bSampled)
+    {
+        bSampled = false;
+        RootComponent->SetWorldLocation(PreSampleLocation, false, nullptr, ETeleportType::TeleportPhysics);
+        RootComponent->ComponentVelocity = PreSampleVelocity;
+    }
+}
+
+float AUR_Lift::GetTravelAlpha(float LinearAlpha) const
+{
+    LinearAlpha = FMath::Clamp(LinearAlpha, 0.f, 1.f);
+
+    if (TravelCurve)
+    {
+        return TravelCurve->GetFloatValue(LinearAlpha);
+    }
+
+    // Same easing as UKismetSystemLibrary::MoveComponentTo
+    if (EaseIn && EaseOut)
+    {
+        return FMath::InterpEaseInOut(0.f, 1.f, LinearAlpha, 2.f);
+    }
+    if (EaseIn)
+    {
+        return FMath::InterpEaseIn(0.f, 1.f, LinearAlpha, 2.f);
+    }
+    if (EaseOut)
+    {
+        return FMath::InterpEaseOut(0.f, 1.f, LinearAlpha, 2.f);
+    }
+
+    return LinearAlpha;
+}
+
+ELiftState AUR_Lift::GetLiftStateAtTime(double ServerTime) const
 {
-    const FLatentActionInfo LatentActionInfo{ 1, 1, TEXT("OnReachedStart"), this };
+    const double Elapsed = ServerTime - CycleStartTime;
+    if (CycleStartTime < 0.0 || Elapsed < 0.0 || Elapsed >= GetCycleDuration())
+    {
+        return ELiftState::Start;
+    }
 
-    UKismetSystemLibrary::MoveComponentTo(RootComponent, StartLocation, FRotator::ZeroRotator, EaseOut, EaseIn, TravelDuration, true, EMoveComponentAction::Type::Move, LatentActionInfo);
+    if (Elapsed >= TravelDuration && Elapsed < TravelDuration + StoppedAtEndPosition)
+    {
+        return ELiftState::End;
+    }
 
-    LiftState = ELiftState::Moving;
+    return ELiftState::Moving;
+}
 
-    PlayLiftEffects();
+FVector AUR_Lift::GetLiftLocationAtTime(double ServerTime) const
+{
+    const double Elapsed = ServerTime - CycleStartTime;
+    if (CycleStartTime < 0.0 || Elapsed <= 0.0 || Elapsed >= GetCycleDuration())
+    {
+        return StartLocation;
+    }
+
+    const double Travel = FMath::Max(TravelDuration, UE_KINDA_SMALL_NUMBER);
+    float Alpha;
+    if (Elapsed < Travel)
+    {
+        Alpha = GetTravelAlpha(Elapsed / Travel);
+    }
+    else if (Elapsed < Travel + StoppedAtEndPosition)
+    {
+        Alpha = 1.f;
+    }
+    else
+    {
+        Alpha = 1.f - GetTravelAlpha((Elapsed - Travel - StoppedAtEndPosition) / Travel);
+    }
+
+    return StartLocation + EndRelativeLocation * Alpha;
+}
+
+void AUR_Lift::StartLiftCycle(double InCycleStartTime)
+{
+    CycleStartTime = InCycleStartTime;
+
+    if (HasAuthority())
+    {
+        ForceNetUpdate();
+    }
+
+    SetActorTickEnabled(true);
+    UpdateLift(GetLiftTime(), 0.f);
+}
+
+void AUR_Lift::OnRep_CycleStartTime()
+{
+    if (HasActorBegunPlay())
+    {
+        StartLiftCycle(CycleStartTime);
+    }
 }
 
-void AUR_Lift::MoveToEndPosition()
+void AUR_Lift::UpdateLift(double ServerTime, float DeltaTime)
 {
-    const FLatentActionInfo LatentActionInfo{ 1, 1, TEXT("OnReachedEnd"), this };
+    const FVector OldLocation = RootComponent->GetComponentLocation();
+    const FVector NewLocation = GetLiftLocationAtTime(ServerTime);
 
-    UKismetSystemLibrary::MoveComponentTo(RootComponent, StartLocation + EndRelativeLocation, FRotator::ZeroRotator, EaseOut, EaseIn, TravelDuration, true, EMoveComponentAction::Type::Move, LatentActionInfo);
+    RootComponent->SetWorldLocation(NewLocation);
+    RootComponent->ComponentVelocity = (DeltaTime > 0.f) ? (NewLocation - OldLocation) / DeltaTime : FVector::ZeroVector;
 
-    LiftState = ELiftState::Moving;
-    PlayLiftEffects();
+    const ELiftState NewState = GetLiftStateAtTime(ServerTime);
+    if (NewState != LiftState)
+    {
+        const ELiftState OldState = LiftState;
+        LiftState = NewState;
+
+        if (NewState == ELiftState::Moving)
+        {
+            PlayLiftEffects();
+        }
+        else if (NewState == ELiftState::End)
+        {
+            OnReachedEnd();
+        }
+        else if (OldState != ELiftState::Start)
+        {
+            OnReachedStart();
+        }
+    }
+
+    if (LiftState == ELiftState::Start && ServerTime - CycleStartTime >= GetCycleDuration())
+    {
+        RootComponent->ComponentVelocity = FVector::ZeroVector;
+        SetActorTickEnabled(false);
+    }
 }
 
 void AUR_Lift::OnReachedStart()
@@ -113,7 +315,6 @@ void AUR_Lift::OnReachedEnd()
 {
     LiftState = ELiftState::End;
     StopLiftEffects();
-    GetWorld()->GetTimerManager().SetTimer(ReturnTimerHandle, this, &AUR_Lift::MoveToStartPosition, StoppedAtEndPosition);
 }
 
 void AUR_Lift::PlayLiftEffects_Implementation()
@@ -13,6 +13,7 @@
 
 class UAudioComponent;
 class UBoxComponent;
+class UCurveFloat;
 class UPrimitiveComponent;
 class UStaticMeshComponent;
 class USoundBase;
@@ -20,7 +21,12 @@ class USoundBase;
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /**
+* Lift that travels to EndRelativeLocation when stepped on, waits, then returns.
 *
+* The position is a pure function of the replicated cycle start time. Riders sample it at the lift time of their
+* character move (see UUR_CharacterMovementComponent::MoveLiftTime), which is stamped on the move by the client and
+* replayed with it, so based movement uses the same lift position on the server and on the client. The lift is only
+* moved there for the duration of that move, everything else sees it at the current time.
 */
 UCLASS()
 class OPENTOURNAMENT_API AUR_Lift : public AActor
@@ -54,8 +60,14 @@ public:
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    virtual void Tick(float DeltaTime) override;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Lift")
@@ -76,10 +88,43 @@ public:
     UFUNCTION(BlueprintCallable)
     void OnReachedEnd();
 
+    /**
+    * Lift location at the given server world time
+    */
+    UFUNCTION(BlueprintPure, Category = "Lift")
+    FVector GetLiftLocationAtTime(double ServerTime) const;
+
+    /**
+    * Current server world time as known locally, the time the lift ticks at and riders stamp their moves with
+    */
+    double GetLiftTime() const;
+
+    /**
+    * Moves the lift to where it is at LiftTime, for a rider's move. RestoreSampledLift must follow once the move is done.
+    */
+    void SampleLiftAtTime(double LiftTime);
+
+    /**
+    * Puts the lift back where it was, with the velocity it had, before SampleLiftAtTime
+    */
+    void RestoreSampledLift();
+
 private:
 
-    void MoveToStartPosition();
-    void MoveToEndPosition();
+    void StartLiftCycle(double InCycleStartTime);
+
+    void UpdateLift(double ServerTime, float DeltaTime);
+
+    UFUNCTION()
+    void OnRep_CycleStartTime();
+
+    // Duration of a full up, wait and down cycle
+    double GetCycleDuration() const { return 2.0 * TravelDuration + StoppedAtEndPosition; }
+
+    // Eased 0..1 travel alpha for a linear 0..1 alpha
+    float GetTravelAlpha(float LinearAlpha) const;
+
+    ELiftState GetLiftStateAtTime(double ServerTime) const;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -114,6 +159,12 @@ public:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Lift")
     bool EaseOut;
 
+    /*
+    * Optional travel curve mapping 0..1 time to 0..1 distance. Overrides EaseIn and EaseOut.
+    */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Lift")
+    TObjectPtr<UCurveFloat> TravelCurve;
+
     /**
     * Lift starts moving
     */
@@ -146,6 +197,14 @@ private:
     UPROPERTY()
     ELiftState LiftState;
 
-    UPROPERTY()
-    FTimerHandle ReturnTimerHandle;
+    // Real location and velocity while a rider's move samples the lift at another time
+    FVector PreSampleLocation = FVector::ZeroVector;
+    FVector PreSampleVelocity = FVector::ZeroVector;
+    bool bSampled = false;
+
+    /*
+    * Server world time the current cycle started at, negative if the lift never moved
+    */
+    UPROPERTY(ReplicatedUsing = OnRep_CycleStartTime)
+    double CycleStartTime;
 };
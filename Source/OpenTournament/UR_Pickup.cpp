@@ -17,6 +17,7 @@
 #include "UR_GameState.h"
 #include "UR_LogChannels.h"
 #include "UR_PlayerState.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_Pickup)
 
@@ -47,6 +48,37 @@ AUR_Pickup::AUR_Pickup(const FObjectInitializer& ObjectInitializer)
     SetReplicatingMovement(false);
 }
 
+void AUR_Pickup::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_Pickup::SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    ExcludedTags = InExcludedTags;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_Pickup::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Pickup);
+}
+
+void AUR_Pickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Pickup);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 void AUR_Pickup::OnOverlap(UPrimitiveComponent* HitComp, AActor* Other, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -79,22 +111,12 @@ bool AUR_Pickup::IsPickupPermitted(const AUR_Character* PickupCharacter) const
 
     // Check if the actor doing the pickup has any Required or Excluded GameplayTags
     // e.g. Check for Red/Blue team tag, or exclude Flag-carrier tag, etc.
-    FGameplayTagContainer TargetTags;
-    PickupCharacter->GetOwnedGameplayTags(TargetTags);
-
-    return IsPermittedByGameplayTags(TargetTags);
+    return TagRequirementQuery.IsActorPermitted(PickupCharacter);
 }
 
 bool AUR_Pickup::IsPermittedByGameplayTags(const FGameplayTagContainer& TargetTags) const
 {
-    if (RequiredTags.Num() == 0 || (bRequiredTagsExact && TargetTags.HasAnyExact(RequiredTags)) || (!bRequiredTagsExact && TargetTags.HasAny(RequiredTags)))
-    {
-        return (ExcludedTags.Num() == 0 || (bExcludedTagsExact && !TargetTags.HasAnyExact(ExcludedTags)) || (!bExcludedTagsExact && TargetTags.HasAny(RequiredTags)));
-    }
-    else
-    {
-        return false;
-    }
+    return TagRequirementQuery.Matches(TargetTags);
 }
 
 /**
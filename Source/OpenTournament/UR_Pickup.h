@@ -9,6 +9,7 @@
 #include "GameFramework/Actor.h"
 
 #include "Enums/UR_PickupState.h"
+#include "GAS/UR_GameplayTagRequirementQuery.h"
 
 #include "UR_Pickup.generated.h"
 
@@ -39,6 +40,12 @@ class OPENTOURNAMENT_API AUR_Pickup
 public:
     AUR_Pickup(const FObjectInitializer& ObjectInitializer);
 
+    virtual void PostInitializeComponents() override;
+
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
     /**
@@ -149,27 +156,38 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
     FGameplayTagContainer GameplayTags;
 
+    /**
+    * Set the Required / Excluded tags at runtime, and recompile the tag requirements
+    */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+    void SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
     /**
     * Are RequiredTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bRequiredTagsExact;
 
     /**
     * Actors attempting to Teleport must have at least one exact Tag match
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer RequiredTags;
 
     /**
     * Are ExcludedTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bExcludedTagsExact;
 
     /**
     * Gameplay Tags for this Actor
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer ExcludedTags;
+
+    /**
+    * RequiredTags / ExcludedTags compiled in PostInitializeComponents and SetTagRequirements
+    */
+    FUR_GameplayTagRequirementQuery TagRequirementQuery;
 };
@@ -17,6 +17,9 @@
 #include <Net/UnrealNetwork.h>
 #include <Particles/ParticleSystemComponent.h>
 
+#include "Weapons/UR_SplashDamage.h"
+#include "System/UR_ActorRegistrySubsystem.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UR_Projectile)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,12 +95,21 @@ void AUR_Projectile::BeginPlay()
 
     Super::BeginPlay();
 
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Projectile);
+
     if (ProjectileMovementComponent->bShouldBounce)
     {
         ProjectileMovementComponent->OnProjectileBounce.AddDynamic(this, &ThisClass::OnBounceInternal);
     }
 }
 
+void AUR_Projectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Projectile);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AUR_Projectile::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -216,21 +228,11 @@ void AUR_Projectile::DealSplashDamage()
     TArray<AActor*> IgnoreActors;
     IgnoreActors.Add(this);
 
-    UGameplayStatics::ApplyRadialDamageWithFalloff
-    (
-        this,
-        BaseDamage,
-        SplashMinimumDamage,
-        GetActorLocation(),
-        InnerSplashRadius,
-        SplashRadius,
-        SplashFalloff,
-        DamageTypeClass,
-        IgnoreActors,
-        this,
-        GetInstigatorController(),
-        ECollisionChannel::ECC_Visibility
-    );
+    FUR_SplashDamageResolver SplashResolver(GetActorLocation(), FRadialDamageParams(BaseDamage, SplashMinimumDamage, InnerSplashRadius, SplashRadius, SplashFalloff), DamageTypeClass, ECollisionChannel::ECC_Visibility);
+    if (SplashResolver.Resolve(GetWorld(), IgnoreActors, this) > 0)
+    {
+        SplashResolver.Apply(GetInstigatorController(), this);
+    }
 }
 
 /**
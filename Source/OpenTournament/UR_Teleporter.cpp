@@ -22,6 +22,7 @@
 #include "UR_LogChannels.h"
 #include "UR_Logging.h"
 #include "AI/UR_NavigationUtilities.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "Misc/AutomationTest.h"
@@ -95,12 +96,44 @@ void AUR_Teleporter::OnConstruction(const FTransform& Transform)
     }
 }
 
+void AUR_Teleporter::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_Teleporter::SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    ExcludedTags = InExcludedTags;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_Teleporter::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Trigger);
+}
+
+void AUR_Teleporter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 void AUR_Teleporter::OnTriggerEnter(UPrimitiveComponent* HitComp, AActor* Other, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-    // @! TODO(Pedro): we should store the "teleporting" state in the MovementComponent of the actor in order to query it here
-    const bool bIsTeleporting = (bFromSweep == false);
+    // Characters keep their teleporting state in the movement component, other actors are
+    // assumed to be arriving from a teleport when the overlap did not come from a sweep
+    const bool bIsTeleporting = (bFromSweep == false) && GetTeleportMovement(Other) == nullptr;
     if (bIsTeleporting)
     {
         return;
@@ -111,7 +144,14 @@ void AUR_Teleporter::OnTriggerEnter(UPrimitiveComponent* HitComp, AActor* Other,
 
 void AUR_Teleporter::OnTriggerExit(UPrimitiveComponent* HitComp, AActor* Other, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
 {
-    if (Other)
+    if (UUR_CharacterMovementComponent* URMovement = GetTeleportMovement(Other))
+    {
+        if (URMovement->GetTeleportExitActor() == this)
+        {
+            URMovement->SetTeleportExitActor(nullptr);
+        }
+    }
+    else if (Other)
     {
         const auto ActorIndex = IgnoredActors.Find(Other);
         if (ActorIndex != INDEX_NONE)
@@ -129,6 +169,17 @@ void AUR_Teleporter::Teleport(AActor* Other)
         return;
     }
 
+    // Characters teleport from inside their next move so the teleport is predicted and replayed like any other movement
+    if (UUR_CharacterMovementComponent* URMovement = GetTeleportMovement(Other))
+    {
+        if (URMovement->GetTeleportExitActor() != this && IsPermittedToTeleport(Other))
+        {
+            GAME_LOG(LogGame, Verbose, "Teleporter (%s) Triggered", *GetName());
+            URMovement->RequestTeleport(this);
+        }
+        return;
+    }
+
     if (IsIgnoredActor(Other))
     {
         IgnoredActors.Remove(Other);
@@ -157,27 +208,13 @@ bool AUR_Teleporter::IsPermittedToTeleport_Implementation(const AActor* TargetAc
         return false;
     }
 
-    if (const auto TagActor = Cast<IGameplayTagAssetInterface>(TargetActor))
-    {
-        // Check if the actor using the Teleporter has any Required or Excluded GameplayTags
-        FGameplayTagContainer TargetTags;
-        TagActor->GetOwnedGameplayTags(TargetTags);
-        return IsPermittedByGameplayTags(TargetTags);
-    }
-
-    return true;
+    // Check if the actor using the Teleporter has any Required or Excluded GameplayTags
+    return TagRequirementQuery.IsActorPermitted(TargetActor);
 }
 
 bool AUR_Teleporter::IsPermittedByGameplayTags(const FGameplayTagContainer& TargetTags) const
 {
-    if (RequiredTags.Num() == 0 || (bRequiredTagsExact && TargetTags.HasAnyExact(RequiredTags)) || (!bRequiredTagsExact && TargetTags.HasAny(RequiredTags)))
-    {
-        return (ExcludedTags.Num() == 0 || (bExcludedTagsExact && !TargetTags.HasAnyExact(ExcludedTags)) || (!bExcludedTagsExact && TargetTags.HasAny(RequiredTags)));
-    }
-    else
-    {
-        return false;
-    }
+    return TagRequirementQuery.Matches(TargetTags);
 }
 
 bool AUR_Teleporter::InternalTeleport(AActor* TargetActor)
@@ -209,18 +246,37 @@ bool AUR_Teleporter::InternalTeleport(AActor* TargetActor)
     // Find out Desired Rotation
     GetDesiredRotation(DesiredRotation, TargetActorRotation, DestinationRotation);
 
+    // Moves replayed after a correction teleport again, but must not repeat effects
+    UUR_CharacterMovementComponent* URMovement = GetTeleportMovement(TargetActor);
+    const bool bIsReplayingMove = TargetCharacter && TargetCharacter->bClientUpdating;
+
     if (AUR_Teleporter* DestinationTeleporter = Cast<AUR_Teleporter>(DestinationActor))
     {
-        DestinationTeleporter->AddIgnoredActor(TargetActor);
+        if (URMovement)
+        {
+            URMovement->SetTeleportExitActor(DestinationTeleporter);
+        }
+        else
+        {
+            DestinationTeleporter->AddIgnoredActor(TargetActor);
+        }
     }
 
     // Try to Perform Our Teleport
     const bool bIsTeleportSuccessful{ TargetActor->TeleportTo(DestinationLocation, DestinationRotation) };
 
+    if (!bIsTeleportSuccessful && URMovement && URMovement->GetTeleportExitActor() == DestinationActor)
+    {
+        URMovement->SetTeleportExitActor(nullptr);
+    }
+
     if (bIsTeleportSuccessful)
     {
         // Play effects associated with teleportation
-        PlayTeleportEffects();
+        if (!bIsReplayingMove)
+        {
+            PlayTeleportEffects();
+        }
 
         // If we successfully teleported, notify our actor.
         // We need to do this to update CharacterMovementComponent.bJustTeleported property
@@ -233,12 +289,24 @@ bool AUR_Teleporter::InternalTeleport(AActor* TargetActor)
 
         ApplyGameplayTag(TargetActor);
 
-        UUR_NavigationUtilities::ForceReachedDestinationWithin(Cast<APawn>(TargetActor), CapsuleComponent->GetNavigationBounds());
+        if (!bIsReplayingMove)
+        {
+            UUR_NavigationUtilities::ForceReachedDestinationWithin(Cast<APawn>(TargetActor), CapsuleComponent->GetNavigationBounds());
+        }
     }
 
     return bIsTeleportSuccessful;
 }
 
+UUR_CharacterMovementComponent* AUR_Teleporter::GetTeleportMovement(const AActor* InActor)
+{
+    if (const ACharacter* Character = Cast<ACharacter>(InActor))
+    {
+        return Cast<UUR_CharacterMovementComponent>(Character->GetCharacterMovement());
+    }
+    return nullptr;
+}
+
 void AUR_Teleporter::GetDesiredRotation(FRotator& DesiredRotation, const FRotator& TargetActorRotation, const FRotator& DestinationRotation) const
 {
     if (ExitRotationType == EExitRotation::Relative)
@@ -298,7 +366,7 @@ void AUR_Teleporter::SetTargetVelocity(AActor* TargetActor, ACharacter* TargetCh
                 auto NewTargetVelocity = DestinationRotation.RotateVector(FVector::ForwardVector * CharacterMovement->Velocity.Size2D());
                 NewTargetVelocity.Z = CharacterMovement->Velocity.Z;
                 CharacterMovement->Velocity = NewTargetVelocity;
-                if (TargetCharacter->GetController())
+                if (TargetCharacter->GetController() && !TargetCharacter->bClientUpdating)
                     TargetCharacter->GetController()->SetControlRotation(DestinationRotation);
             }
             else
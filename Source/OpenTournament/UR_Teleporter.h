@@ -8,6 +8,8 @@
 #include "GameplayTagAssetInterface.h"
 #include "GameFramework/Actor.h"
 
+#include "GAS/UR_GameplayTagRequirementQuery.h"
+
 #include "UR_Type_ExitRotation.h"
 
 #include "UR_Teleporter.generated.h"
@@ -15,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 class ACharacter;
+class UUR_CharacterMovementComponent;
 class UArrowComponent;
 class UAudioComponent;
 class UCapsuleComponent;
@@ -90,6 +93,12 @@ public:
 
     virtual void OnConstruction(const FTransform& Transform) override;
 
+    virtual void PostInitializeComponents() override;
+
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Teleport Behavior
 
@@ -126,10 +135,16 @@ public:
 
     /**
     * Internal Teleport. Actually performs the Teleport.
+    * Characters using UUR_CharacterMovementComponent get here from inside a move (see RequestTeleport).
     * Return true if successful.
     */
     bool InternalTeleport(AActor* TargetActor);
 
+    /**
+    * Movement component tracking the teleport state of InActor, if it is a character using ours
+    */
+    static UUR_CharacterMovementComponent* GetTeleportMovement(const AActor* InActor);
+
     /**
     * Get the DesiredRotation for the TargetActor
     */
@@ -202,6 +217,7 @@ public:
     /**
     * Actors we Ignore the next single Teleport they engage in.
     * Used to exclude Teleportee from bouncing between connected Teleporters.
+    * Characters track this in their movement component instead, so it is rolled back with their moves.
     */
     UPROPERTY(BlueprintReadOnly, VisibleInstanceOnly, Category = "Teleporter|Debug")
     TArray<AActor*> IgnoredActors;
@@ -327,30 +343,41 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
     FGameplayTagContainer GameplayTags;
 
+    /**
+    * Set the Required / Excluded tags at runtime, and recompile the tag requirements
+    */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+    void SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
     /**
     * Are RequiredTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bRequiredTagsExact;
 
     /**
     * Actors attempting to Teleport must have at least one exact Tag match
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer RequiredTags;
 
     /**
     * Are ExcludedTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bExcludedTagsExact;
 
     /**
     * Gameplay Tags for this Actor
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer ExcludedTags;
 
+    /**
+    * RequiredTags / ExcludedTags compiled in PostInitializeComponents and SetTagRequirements
+    */
+    FUR_GameplayTagRequirementQuery TagRequirementQuery;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Dynamic MaterialInstance
 
@@ -13,6 +13,8 @@
 
 #include "OpenTournament.h"
 #include "UR_Character.h"
+#include "Teams/UR_TeamSubsystem.h"
+#include "System/UR_ActorRegistrySubsystem.h"
 
 #if WITH_EDITOR
 #include "Misc/MapErrors.h"
@@ -30,6 +32,20 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace URTriggerZone
+{
+    // Team ids are small and dense, anything past this is counted as having no team
+    static constexpr int32 MaxOccupancySlots = 32;
+
+    static int32 GetOccupancySlot(int32 TeamId)
+    {
+        const int32 Slot = TeamId + 1;
+        return ensureMsgf(Slot >= 0 && Slot < MaxOccupancySlots, TEXT("TriggerZone cannot count occupants of team %d"), TeamId) ? Slot : 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 AUR_TriggerZone::AUR_TriggerZone(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , ShapeComponent(nullptr)
@@ -42,6 +58,18 @@ AUR_TriggerZone::AUR_TriggerZone(const FObjectInitializer& ObjectInitializer)
     , ExcludedTags()
 {
     TriggerActors.Reserve(4);
+
+    // Not replicated by default, so it can be a child actor of non-replicated owners.
+    // Standalone zones that enable replication only send their per-team counts, overlaps are evaluated on every machine.
+    SetReplicatingMovement(false);
+    SetNetUpdateFrequency(1.f);
+}
+
+void AUR_TriggerZone::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ThisClass, TeamOccupancy);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +78,8 @@ void AUR_TriggerZone::PostInitializeComponents()
 {
     Super::PostInitializeComponents();
 
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+
     if (!ShapeComponent)
     {
         ShapeComponent = FindComponentByClass<UShapeComponent>();
@@ -62,6 +92,30 @@ void AUR_TriggerZone::PostInitializeComponents()
     }
 }
 
+void AUR_TriggerZone::SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact)
+{
+    RequiredTags = InRequiredTags;
+    bRequiredTagsExact = bInRequiredTagsExact;
+    ExcludedTags = InExcludedTags;
+    bExcludedTagsExact = bInExcludedTagsExact;
+
+    TagRequirementQuery.Compile(RequiredTags, bRequiredTagsExact, ExcludedTags, bExcludedTagsExact);
+}
+
+void AUR_TriggerZone::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UUR_ActorRegistrySubsystem::RegisterActor(this, EUR_ActorRegistryCategory::Trigger);
+}
+
+void AUR_TriggerZone::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UUR_ActorRegistrySubsystem::UnregisterActor(this, EUR_ActorRegistryCategory::Trigger);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if WITH_EDITOR
@@ -86,7 +140,14 @@ void AUR_TriggerZone::CheckForErrors()
 
 void AUR_TriggerZone::InternalZoneEnter(AActor* InActor)
 {
-    if (!InActor->GetClass()->IsChildOf(TriggerActorClass))
+    if (!InActor->GetClass()->IsChildOf(TriggerActorClass) || IsOccupant(InActor))
+    {
+        return;
+    }
+
+    // Dying Characters keep overlapping until their collision is disabled
+    const AUR_Character* Character = Cast<AUR_Character>(InActor);
+    if (Character && !Character->IsAlive())
     {
         return;
     }
@@ -94,6 +155,7 @@ void AUR_TriggerZone::InternalZoneEnter(AActor* InActor)
     if (IsTriggerActor(InActor))
     {
         TriggerActors.AddUnique(InActor);
+        AddOccupant(InActor);
         OnEnter(InActor);
         OnActorEnter.Broadcast(InActor);
     }
@@ -121,6 +183,7 @@ void AUR_TriggerZone::InternalZoneExit(AActor* InActor)
     if (TriggerActors.Contains(InActor))
     {
         TriggerActors.Remove(InActor);
+        RemoveOccupant(InActor);
         OnExit(InActor);
         OnActorExit.Broadcast(InActor);
     }
@@ -138,32 +201,144 @@ void AUR_TriggerZone::ZoneExit(AActor* InActor)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool AUR_TriggerZone::IsTriggerActor_Implementation(const AActor* InActor) const
+int32 AUR_TriggerZone::GetTeamOccupancy(int32 TeamId) const
+{
+    const int32 Slot = TeamId + 1;
+    return TeamOccupancy.IsValidIndex(Slot) ? TeamOccupancy[Slot] : 0;
+}
+
+AActor* AUR_TriggerZone::FindOccupantOfTeam(int32 TeamId) const
 {
-    if (const auto TagActor = Cast<IGameplayTagAssetInterface>(InActor))
+    for (const TPair<TObjectKey<AActor>, int32>& Occupant : OccupantTeams)
     {
-        // Check if the Character has any Required or Excluded GameplayTags
-        FGameplayTagContainer TargetTags;
-        TagActor->GetOwnedGameplayTags(TargetTags);
+        if (Occupant.Value == TeamId)
+        {
+            return Occupant.Key.ResolveObjectPtr();
+        }
+    }
+    return nullptr;
+}
+
+void AUR_TriggerZone::SetTeamOccupancy(const TArray<uint8>& InTeamOccupancy)
+{
+    TeamOccupancy = InTeamOccupancy;
+    UpdateOccupancySummary();
+    OnOccupancyChanged.Broadcast();
+}
 
-        return IsTriggerByGameplayTags(TargetTags);
+void AUR_TriggerZone::OnRep_TeamOccupancy()
+{
+    UpdateOccupancySummary();
+    OnOccupancyChanged.Broadcast();
+}
+
+void AUR_TriggerZone::OnTriggerActorDied(AUR_Character* Character, AController* Killer)
+{
+    InternalZoneExit(Character);
+}
+
+void AUR_TriggerZone::OnTriggerActorDestroyed(AActor* DestroyedActor)
+{
+    InternalZoneExit(DestroyedActor);
+}
+
+void AUR_TriggerZone::AddOccupant(AActor* InActor)
+{
+    const UUR_TeamSubsystem* TeamSubsystem = GetWorld()->GetSubsystem<UUR_TeamSubsystem>();
+    const int32 TeamId = TeamSubsystem ? TeamSubsystem->FindTeamFromObject(InActor) : INDEX_NONE;
+    OccupantTeams.Add(InActor, TeamId);
+
+    // Leaving the Zone without an EndOverlap (death, destruction) must still be counted
+    InActor->OnDestroyed.AddUniqueDynamic(this, &ThisClass::OnTriggerActorDestroyed);
+    if (AUR_Character* Character = Cast<AUR_Character>(InActor))
+    {
+        Character->OnDeath.AddUniqueDynamic(this, &ThisClass::OnTriggerActorDied);
     }
 
-    return true;
+    // Counted on the server only, a client's local child Zone has authority but gets its counts from the owner
+    if (!IsNetMode(NM_Client))
+    {
+        const int32 Slot = URTriggerZone::GetOccupancySlot(TeamId);
+        if (!TeamOccupancy.IsValidIndex(Slot))
+        {
+            TeamOccupancy.SetNumZeroed(Slot + 1);
+        }
+
+        if (ensure(TeamOccupancy[Slot] < MAX_uint8))
+        {
+            ++TeamOccupancy[Slot];
+        }
+
+        UpdateOccupancySummary();
+        ForceNetUpdate();
+        OnOccupancyChanged.Broadcast();
+    }
 }
 
-bool AUR_TriggerZone::IsTriggerByGameplayTags(const FGameplayTagContainer& TargetTags) const
+void AUR_TriggerZone::RemoveOccupant(AActor* InActor)
 {
-    if (RequiredTags.Num() == 0 || (bRequiredTagsExact && TargetTags.HasAnyExact(RequiredTags)) || (!bRequiredTagsExact && TargetTags.HasAny(RequiredTags)))
+    int32 TeamId = INDEX_NONE;
+    if (!OccupantTeams.RemoveAndCopyValue(InActor, TeamId))
     {
-        return (ExcludedTags.Num() == 0 || (bExcludedTagsExact && !TargetTags.HasAnyExact(ExcludedTags)) || (!bExcludedTagsExact && TargetTags.HasAny(RequiredTags)));
+        return;
     }
-    else
+
+    InActor->OnDestroyed.RemoveDynamic(this, &ThisClass::OnTriggerActorDestroyed);
+    if (AUR_Character* Character = Cast<AUR_Character>(InActor))
+    {
+        Character->OnDeath.RemoveDynamic(this, &ThisClass::OnTriggerActorDied);
+    }
+
+    if (!IsNetMode(NM_Client))
     {
-        return false;
+        const int32 Slot = URTriggerZone::GetOccupancySlot(TeamId);
+        if (TeamOccupancy.IsValidIndex(Slot) && TeamOccupancy[Slot] > 0)
+        {
+            --TeamOccupancy[Slot];
+        }
+
+        UpdateOccupancySummary();
+        ForceNetUpdate();
+        OnOccupancyChanged.Broadcast();
     }
 }
 
+void AUR_TriggerZone::UpdateOccupancySummary()
+{
+    NumOccupants = 0;
+    NumOccupyingTeams = 0;
+    SoleOccupyingTeam = INDEX_NONE;
+
+    // Bounded by the number of teams, not the number of occupants
+    for (int32 Slot = 0; Slot < TeamOccupancy.Num(); ++Slot)
+    {
+        if (TeamOccupancy[Slot] > 0)
+        {
+            NumOccupants += TeamOccupancy[Slot];
+            ++NumOccupyingTeams;
+            SoleOccupyingTeam = Slot - 1;
+        }
+    }
+
+    if (NumOccupyingTeams != 1)
+    {
+        SoleOccupyingTeam = INDEX_NONE;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AUR_TriggerZone::IsTriggerActor_Implementation(const AActor* InActor) const
+{
+    // Check if the Character has any Required or Excluded GameplayTags
+    return TagRequirementQuery.IsActorPermitted(InActor);
+}
+
+bool AUR_TriggerZone::IsTriggerByGameplayTags(const FGameplayTagContainer& TargetTags) const
+{
+    return TagRequirementQuery.Matches(TargetTags);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if WITH_EDITOR
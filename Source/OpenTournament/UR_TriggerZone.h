@@ -8,11 +8,15 @@
 #include "GameplayTagAssetInterface.h"
 #include "GameFramework/Actor.h"
 
+#include "GAS/UR_GameplayTagRequirementQuery.h"
+
 #include "UR_TriggerZone.generated.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward Declarations
 
+class AController;
+class AUR_Character;
 class UPrimitiveComponent;
 class UShapeComponent;
 
@@ -23,6 +27,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActorEnter, AActor*, EnteringActo
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActorExit, AActor*, ExitingActor);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnZoneOccupancyChanged);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -38,12 +44,16 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActorExit, AActor*, ExitingActor)
 * can be formed by creating BP subclasses utilizing additional shape components.
 * Upon entering these sub-zones, use overlap events within the BP to add/remove actors from the tracked Actors.
 *
+* Occupants are also counted per team as they enter and exit. Occupants that die or are destroyed inside
+* the zone are removed immediately. The per-team counts are kept by the server, clients receive them either through
+* the zone's own replication (standalone zones with replication enabled) or from the owning actor, which pushes them
+* with SetTeamOccupancy (see AUR_ControlPoint, whose zone is a local child actor on every machine).
+*
 * This class is abstract.
 * For placeable versions, see AUR_TriggerZone_Box & AUR_TriggerZone_Capsule.
 *
 * @! TODO: Issues to Address
-* - Characters Entering Zone by unusual means (Spawning, Teleporting)
-* - Characters Leaving Zone by alternate means (Dying, Teleporting)
+* - Characters Entering Zone by unusual means (Spawning)
 */
 UCLASS(Abstract, NotBlueprintable, HideCategories = (Tick, Rendering, Replication, Input, Actor, LOD, Cooking))
 class OPENTOURNAMENT_API AUR_TriggerZone
@@ -58,13 +68,17 @@ public:
 
     /////////////////////////////////////////////////////////////////////////////////////////////////
 
-    //virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
     /**
     * Override PostInitializeComponents to Bind ShapeComponent Events
     */
     virtual void PostInitializeComponents() override;
 
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #if WITH_EDITOR
     /**
     * Check for Errors to find instances where this actor is configured incorrectly.
@@ -171,6 +185,81 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TriggerZone")
     TArray<AActor*> TriggerActors;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    // Occupancy
+
+    /**
+    * Number of Triggering Actors of the given Team in the Zone. INDEX_NONE counts Actors without a Team.
+    */
+    UFUNCTION(BlueprintPure, Category = "TriggerZone")
+    int32 GetTeamOccupancy(int32 TeamId) const;
+
+    /**
+    * Number of Triggering Actors in the Zone
+    */
+    UFUNCTION(BlueprintPure, Category = "TriggerZone")
+    int32 GetNumOccupants() const { return NumOccupants; }
+
+    /**
+    * Number of distinct Teams with Actors in the Zone. Actors without a Team count as one Team.
+    */
+    UFUNCTION(BlueprintPure, Category = "TriggerZone")
+    int32 GetNumOccupyingTeams() const { return NumOccupyingTeams; }
+
+    /**
+    * The only Team with Actors in the Zone. INDEX_NONE if the Zone is empty, shared by several Teams or only holds Actors without a Team.
+    */
+    UFUNCTION(BlueprintPure, Category = "TriggerZone")
+    int32 GetSoleOccupyingTeam() const { return SoleOccupyingTeam; }
+
+    /**
+    * Is the Actor currently counted as an occupant of the Zone?
+    */
+    bool IsOccupant(const AActor* InActor) const { return OccupantTeams.Contains(InActor); }
+
+    /**
+    * Any occupant counted under the given Team, nullptr if there is none
+    */
+    AActor* FindOccupantOfTeam(int32 TeamId) const;
+
+    /**
+    * Occupant count per Team, indexed by TeamId + 1 so that slot 0 holds Actors without a Team
+    */
+    const TArray<uint8>& GetTeamOccupancyCounts() const { return TeamOccupancy; }
+
+    /**
+    * Sets the per-Team counts on a client, for a Zone whose counts are replicated by its owner
+    */
+    void SetTeamOccupancy(const TArray<uint8>& InTeamOccupancy);
+
+    /**
+    * Event Binding / Delegate Hook for Events fired when the per-Team counts change
+    */
+    UPROPERTY(BlueprintAssignable)
+    FOnZoneOccupancyChanged OnOccupancyChanged;
+
+protected:
+    /**
+    * Occupant count per Team, indexed by TeamId + 1 so that slot 0 holds Actors without a Team
+    */
+    UPROPERTY(ReplicatedUsing = OnRep_TeamOccupancy)
+    TArray<uint8> TeamOccupancy;
+
+    UFUNCTION()
+    void OnRep_TeamOccupancy();
+
+    UFUNCTION()
+    void OnTriggerActorDied(AUR_Character* Character, AController* Killer);
+
+    UFUNCTION()
+    void OnTriggerActorDestroyed(AActor* DestroyedActor);
+
+    void AddOccupant(AActor* InActor);
+    void RemoveOccupant(AActor* InActor);
+    void UpdateOccupancySummary();
+
+public:
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Gameplay Tags
 
@@ -185,34 +274,54 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
     FGameplayTagContainer GameplayTags;
 
+    /**
+    * Set the Required / Excluded tags at runtime, and recompile the tag requirements
+    */
+    UFUNCTION(BlueprintCallable, Category = "GameplayTags")
+    void SetTagRequirements(const FGameplayTagContainer& InRequiredTags, bool bInRequiredTagsExact, const FGameplayTagContainer& InExcludedTags, bool bInExcludedTagsExact);
+
     /**
     * Are RequiredTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bRequiredTagsExact;
 
     /**
     * Actors attempting to Capture must have at least one exact Tag match
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer RequiredTags;
 
     /**
     * Are ExcludedTags Exact?
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     bool bExcludedTagsExact;
 
     /**
     * Gameplay Tags for this Actor
     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameplayTags")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameplayTags")
     FGameplayTagContainer ExcludedTags;
 
+    /**
+    * RequiredTags / ExcludedTags compiled in PostInitializeComponents and SetTagRequirements
+    */
+    FUR_GameplayTagRequirementQuery TagRequirementQuery;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Conditional Edit Properties
 
 #if WITH_EDITOR
     virtual bool CanEditChange(const FProperty* InProperty) const override;
 #endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    // Team each occupant was counted under when it entered, so a team change inside the Zone cannot unbalance the counts
+    TMap<TObjectKey<AActor>, int32> OccupantTeams;
+
+    int32 NumOccupants = 0;
+    int32 NumOccupyingTeams = 0;
+    int32 SoleOccupyingTeam = INDEX_NONE;
 };
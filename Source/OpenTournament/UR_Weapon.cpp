@@ -1290,6 +1290,16 @@ void AUR_Weapon::SimulateContinuousHitCheck_Implementation(UUR_FireModeContinuou
     * For something like minigun, we should just do server hit detection,
     * because I don't feel like syncing up each individual randomly spreaded bullet.
     */
+
+    // Authority already traced this step
+    if (HasAuthority())
+    {
+        return;
+    }
+
+    FHitResult Hit;
+    FVector FireDir;
+    ContinuousBeamTrace(FireMode, Hit, FireDir);
 }
 
 void AUR_Weapon::AuthorityStartContinuousFire_Implementation(UUR_FireModeContinuous* FireMode)
@@ -1322,26 +1332,35 @@ void AUR_Weapon::AuthorityContinuousHitCheck_Implementation(UUR_FireModeContinuo
         FireMode->AmmoCostAccumulator -= 1.f;
     }
 
+    FHitResult Hit;
+    FVector FireDir;
+    ContinuousBeamTrace(FireMode, Hit, FireDir);
+
+    if (Hit.bBlockingHit && Hit.GetActor())
+    {
+        float Damage = FireMode->Damage;
+        auto DamType = FireMode->DamageType;
+        UGameplayStatics::ApplyPointDamage(Hit.GetActor(), Damage, FireDir, Hit, GetInstigatorController(), this, DamType);
+    }
+}
+
+void AUR_Weapon::ContinuousBeamTrace(UUR_FireModeContinuous* FireMode, FHitResult& OutHit, FVector& OutFireDir)
+{
     FVector FireLoc;
     FRotator FireRot;
     GetFireVector(FireLoc, FireRot);
 
+    OutFireDir = FireRot.Vector();
     if (FireMode->Spread > 0.f)
     {
-        FireRot = FMath::VRandCone(FireRot.Vector(), FMath::DegreesToRadians(FireMode->Spread)).Rotation();
+        OutFireDir = FMath::VRandCone(OutFireDir, FMath::DegreesToRadians(FireMode->Spread));
     }
 
-    FVector TraceEnd = FireLoc + FireMode->TraceDistance * FireRot.Vector();
-
-    FHitResult Hit;
-    HitscanTrace(FireLoc, TraceEnd, Hit);
+    const FVector TraceEnd = FireLoc + FireMode->TraceDistance * OutFireDir;
+    HitscanTrace(FireLoc, TraceEnd, OutHit);
 
-    if (Hit.bBlockingHit && Hit.GetActor())
-    {
-        float Damage = FireMode->Damage;
-        auto DamType = FireMode->DamageType;
-        UGameplayStatics::ApplyPointDamage(Hit.GetActor(), Damage, FireRot.Vector(), Hit, GetInstigatorController(), this, DamType);
-    }
+    FireMode->LatestBeamHit = OutHit;
+    FireMode->bHasLatestBeamHit = true;
 }
 
 void AUR_Weapon::AuthorityStopContinuousFire_Implementation(UUR_FireModeContinuous* FireMode)
@@ -1381,21 +1400,16 @@ void AUR_Weapon::UpdateContinuousEffects_Implementation(UUR_FireModeContinuous*
         FRotator FireRot;
         GetFireVector(FireLoc, FireRot);
 
-        if (FireMode->Spread > 0.f)
-        {
-            FireRot = FMath::VRandCone(FireRot.Vector(), FMath::DegreesToRadians(FireMode->Spread)).Rotation();
-        }
-
-        FVector TraceEnd = FireLoc + FireMode->TraceDistance * FireRot.Vector();
-
-        FHitResult Hit;
-        HitscanTrace(FireLoc, TraceEnd, Hit);
+        // No trace here, the beam follows aim with the length and impact of the latest hit check
+        const FHitResult& Hit = FireMode->LatestBeamHit;
+        const float BeamLength = FireMode->bHasLatestBeamHit ? (Hit.Location - Hit.TraceStart).Size() : FireMode->TraceDistance;
+        const FVector ImpactNormal = FireMode->bHasLatestBeamHit ? FVector(Hit.ImpactNormal) : FireRot.Vector();
 
-        FVector BeamVector = Hit.Location - FireMode->BeamComponent->GetComponentLocation();
+        FVector BeamVector = FireLoc + BeamLength * FireRot.Vector() - FireMode->BeamComponent->GetComponentLocation();
         BeamVector = FireMode->BeamComponent->GetComponentTransform().InverseTransformVector(BeamVector);
 
         FireMode->BeamComponent->SetVectorParameter(FireMode->BeamVectorParamName, BeamVector);
-        FireMode->BeamComponent->SetVectorParameter(FireMode->BeamImpactNormalParamName, Hit.ImpactNormal);
+        FireMode->BeamComponent->SetVectorParameter(FireMode->BeamImpactNormalParamName, ImpactNormal);
 
         //TODO: There is an issue here, if player/viewer changes 1P/3P perspective while firing,
         // the effect (and sound) need to be re-attached to the appropriate weapon mesh.
@@ -490,4 +490,7 @@ public:
     virtual void UpdateContinuousEffects_Implementation(UUR_FireModeContinuous* FireMode, float DeltaTime) override;
 
     virtual void StopContinuousEffects_Implementation(UUR_FireModeContinuous* FireMode) override;
+
+    /** Trace the beam of a continuous firemode and store the result as its latest beam hit */
+    void ContinuousBeamTrace(UUR_FireModeContinuous* FireMode, FHitResult& OutHit, FVector& OutFireDir);
 };
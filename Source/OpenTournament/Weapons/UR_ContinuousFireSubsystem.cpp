@@ -0,0 +1,104 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_ContinuousFireSubsystem.h"
+
+#include "UR_FireModeContinuous.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(UR_ContinuousFireSubsystem)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace OTConsoleVariables
+{
+    static int32 ContinuousFireMaxSteps = 4;
+    static FAutoConsoleVariableRef CVarContinuousFireMaxSteps
+    (
+        TEXT("OT.Weapon.ContinuousFireMaxSteps"),
+        ContinuousFireMaxSteps,
+        TEXT("Maximum number of hit checks a continuous firemode can run in a single frame to catch up after a hitch."),
+        ECVF_Default
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UUR_ContinuousFireSubsystem::Deinitialize()
+{
+    ActiveFireModes.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UUR_ContinuousFireSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UUR_ContinuousFireSubsystem, STATGROUP_Tickables);
+}
+
+void UUR_ContinuousFireSubsystem::RegisterFireMode(UUR_FireModeContinuous* FireMode)
+{
+    if (FireMode == nullptr)
+    {
+        return;
+    }
+
+    for (const FActiveFireMode& Entry : ActiveFireModes)
+    {
+        if (Entry.FireMode == FireMode)
+        {
+            return;
+        }
+    }
+
+    FActiveFireMode& Entry = ActiveFireModes.AddDefaulted_GetRef();
+    Entry.FireMode = FireMode;
+}
+
+void UUR_ContinuousFireSubsystem::UnregisterFireMode(UUR_FireModeContinuous* FireMode)
+{
+    for (FActiveFireMode& Entry : ActiveFireModes)
+    {
+        if (Entry.FireMode == FireMode)
+        {
+            Entry.FireMode = nullptr;
+            Entry.PendingSteps = 0;
+        }
+    }
+}
+
+void UUR_ContinuousFireSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    ActiveFireModes.RemoveAll([](const FActiveFireMode& Entry) { return !Entry.FireMode.IsValid(); });
+
+    if (ActiveFireModes.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 MaxSteps = FMath::Max(1, OTConsoleVariables::ContinuousFireMaxSteps);
+
+    int32 NumSteps = 0;
+    for (FActiveFireMode& Entry : ActiveFireModes)
+    {
+        Entry.PendingSteps = Entry.FireMode->AdvanceHitCheckClock(DeltaTime, MaxSteps);
+        NumSteps = FMath::Max(NumSteps, Entry.PendingSteps);
+    }
+
+    // Index loops, a hit check can start or stop any firemode
+    for (int32 Step = 0; Step < NumSteps; Step++)
+    {
+        for (int32 i = 0; i < ActiveFireModes.Num(); i++)
+        {
+            if (ActiveFireModes[i].PendingSteps > Step)
+            {
+                if (UUR_FireModeContinuous* FireMode = ActiveFireModes[i].FireMode.Get())
+                {
+                    FireMode->HitCheckStep();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <Subsystems/WorldSubsystem.h>
+
+#include "UR_ContinuousFireSubsystem.generated.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class UUR_FireModeContinuous;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs the hit checks of every firing continuous firemode (beams, miniguns...) at a fixed rate.
+ *
+ * Each firemode keeps its own HitCheckInterval clock and carries the remainder over to the next frame,
+ * so damage over time no longer depends on framerate. Due hit checks are run step by step across all
+ * active firemodes, so every beam traces within the same pass. A frame can run at most
+ * OT.Weapon.ContinuousFireMaxSteps hit checks per firemode, time beyond that is dropped.
+ */
+UCLASS()
+class OPENTOURNAMENT_API UUR_ContinuousFireSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~USubsystem interface
+    virtual void Deinitialize() override;
+    //~End of USubsystem interface
+
+    //~FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    //~End of FTickableGameObject interface
+
+    void RegisterFireMode(UUR_FireModeContinuous* FireMode);
+
+    void UnregisterFireMode(UUR_FireModeContinuous* FireMode);
+
+private:
+    struct FActiveFireMode
+    {
+        TWeakObjectPtr<UUR_FireModeContinuous> FireMode;
+        int32 PendingSteps = 0;
+    };
+
+    // Unregistered entries are cleared in place and compacted on next tick, hit checks may stop firing
+    TArray<FActiveFireMode> ActiveFireModes;
+};
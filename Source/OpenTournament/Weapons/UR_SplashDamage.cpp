@@ -0,0 +1,228 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UR_SplashDamage.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/DamageType.h"
+#include "Math/VectorRegister.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace URSplashDamage
+{
+    struct FCandidate
+    {
+        UPrimitiveComponent* Component;
+        int32 VictimIndex;
+    };
+
+    /**
+    * Same test as ComponentIsDamageableFrom in GameplayStatics.
+    * Trace to the component bounds center, a blocking hit on anything else occludes it.
+    */
+    static bool IsComponentDamageableFrom(const UWorld* World, UPrimitiveComponent* Component, const FVector& Origin, ECollisionChannel TraceChannel, const FCollisionQueryParams& LineParams, FHitResult& OutHit)
+    {
+        const FVector TraceEnd = Component->Bounds.Origin;
+        FVector TraceStart = Origin;
+        if (TraceStart == TraceEnd)
+        {
+            TraceStart.Z += 0.01f;
+        }
+
+        if (TraceChannel != ECC_MAX && World->LineTraceSingleByChannel(OutHit, TraceStart, TraceEnd, TraceChannel, LineParams))
+        {
+            return OutHit.Component == Component;
+        }
+
+        // Nothing in the way, model the hit at the component's location
+        const FVector FakeHitLocation = Component->GetComponentLocation();
+        const FVector FakeHitNormal = (Origin - FakeHitLocation).GetSafeNormal();
+        OutHit = FHitResult(Component, FakeHitLocation, FakeHitNormal, FakeHitNormal);
+        return true;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+FUR_SplashDamageResolver::FUR_SplashDamageResolver(const FVector& InOrigin, const FRadialDamageParams& InParams, TSubclassOf<UDamageType> InDamageTypeClass, ECollisionChannel InPreventionChannel)
+    : Origin(InOrigin)
+    , Params(InParams)
+    , DamageTypeClass(InDamageTypeClass ? InDamageTypeClass : TSubclassOf<UDamageType>(UDamageType::StaticClass()))
+    , PreventionChannel(InPreventionChannel)
+{
+}
+
+int32 FUR_SplashDamageResolver::Resolve(const UWorld* World, const TArray<AActor*>& IgnoreActors, const AActor* DamageCauser)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_URSplashDamage_Resolve);
+
+    Victims.Reset();
+
+    if (World == nullptr)
+    {
+        return 0;
+    }
+
+    // Gather
+
+    FCollisionQueryParams SphereParams(SCENE_QUERY_STAT(URSplashDamage_Overlap), false, DamageCauser);
+    SphereParams.AddIgnoredActors(IgnoreActors);
+
+    TArray<FOverlapResult, TInlineAllocator<16>> Overlaps;
+    World->OverlapMultiByObjectType(Overlaps, Origin, FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(Params.OuterRadius), SphereParams);
+
+    TArray<URSplashDamage::FCandidate, TInlineAllocator<16>> Candidates;
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        AActor* OverlapActor = Overlap.GetActor();
+        UPrimitiveComponent* OverlapComponent = Overlap.GetComponent();
+        if (OverlapActor && OverlapComponent && OverlapActor->CanBeDamaged() && OverlapActor != DamageCauser)
+        {
+            // Victims keep overlap order, which is the order ApplyRadialDamage applies damage in
+            int32 VictimIndex = Victims.IndexOfByPredicate([OverlapActor](const FUR_SplashDamageVictim& Victim) { return Victim.Actor == OverlapActor; });
+            if (VictimIndex == INDEX_NONE)
+            {
+                VictimIndex = Victims.AddDefaulted();
+                Victims[VictimIndex].Actor = OverlapActor;
+            }
+            Candidates.Add({ OverlapComponent, VictimIndex });
+        }
+    }
+
+    // Occlusion
+
+    FCollisionQueryParams LineParams(SCENE_QUERY_STAT(URSplashDamage_Occlusion), true, DamageCauser);
+    LineParams.AddIgnoredActors(IgnoreActors);
+
+    for (const URSplashDamage::FCandidate& Candidate : Candidates)
+    {
+        FHitResult Hit;
+        if (URSplashDamage::IsComponentDamageableFrom(World, Candidate.Component, Origin, PreventionChannel, LineParams, Hit))
+        {
+            Victims[Candidate.VictimIndex].ComponentHits.Add(MoveTemp(Hit));
+        }
+    }
+
+    // Fully occluded actors are not victims
+    Victims.RemoveAll([](const FUR_SplashDamageVictim& Victim) { return Victim.ComponentHits.Num() == 0; });
+
+    // Falloff
+
+    ComputeFalloff();
+
+    return Victims.Num();
+}
+
+void FUR_SplashDamageResolver::ComputeFalloff()
+{
+    const int32 NumVictims = Victims.Num();
+    if (NumVictims == 0)
+    {
+        return;
+    }
+
+    // Lanes are padded to a multiple of 4, padding is computed and discarded
+    const int32 NumLanes = Align(NumVictims, 4);
+
+    TArray<float, TInlineAllocator<40>> Lanes;
+    Lanes.SetNumZeroed(NumLanes * 4);
+    float* Distances = Lanes.GetData();
+    float* Scales = Distances + NumLanes;
+    float* Damages = Scales + NumLanes;
+    float* KnockbackScales = Damages + NumLanes;
+
+    // Closest hit per victim, like AActor::InternalTakeRadialDamage.
+    // Relative to the origin so floats keep their precision anywhere on the map.
+    for (int32 i = 0; i < NumVictims; i++)
+    {
+        float ClosestDistSq = UE_MAX_FLT;
+        for (const FHitResult& Hit : Victims[i].ComponentHits)
+        {
+            ClosestDistSq = FMath::Min(ClosestDistSq, static_cast<float>((Hit.ImpactPoint - Origin).SizeSquared()));
+        }
+        Distances[i] = ClosestDistSq;
+    }
+
+    // FRadialDamageParams::GetDamageScale, then lerp from MinimumDamage to BaseDamage
+    const float InnerRadius = FMath::Max(0.f, Params.InnerRadius);
+    const float OuterRadius = FMath::Max(Params.OuterRadius, InnerRadius);
+    const bool bFalloff = (Params.DamageFalloff != 0.f) && (OuterRadius > InnerRadius);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Inner = VectorSetFloat1(InnerRadius);
+    const VectorRegister4Float Outer = VectorSetFloat1(OuterRadius);
+    const VectorRegister4Float InvRange = VectorSetFloat1(bFalloff ? 1.f / (OuterRadius - InnerRadius) : 0.f);
+    const VectorRegister4Float Exponent = VectorSetFloat1(Params.DamageFalloff);
+    const VectorRegister4Float MinDamage = VectorSetFloat1(Params.MinimumDamage);
+    const VectorRegister4Float DamageRange = VectorSetFloat1(Params.BaseDamage - Params.MinimumDamage);
+    const VectorRegister4Float InvBaseDamage = VectorSetFloat1(Params.BaseDamage != 0.f ? 1.f / Params.BaseDamage : 0.f);
+
+    for (int32 i = 0; i < NumLanes; i += 4)
+    {
+        const VectorRegister4Float Dist = VectorSqrt(VectorLoad(Distances + i));
+
+        VectorRegister4Float Scale = One;
+        if (bFalloff)
+        {
+            // Strictly positive inside the outer radius, clamped so Pow never sees a negative base
+            Scale = VectorSubtract(One, VectorMultiply(VectorSubtract(Dist, Inner), InvRange));
+            Scale = VectorPow(VectorMax(Scale, Zero), Exponent);
+            Scale = VectorSelect(VectorCompareLE(Dist, Inner), One, Scale);
+        }
+        Scale = VectorSelect(VectorCompareGE(Dist, Outer), Zero, Scale);
+
+        VectorStore(Dist, Distances + i);
+        VectorStore(Scale, Scales + i);
+        const VectorRegister4Float Damage = VectorMultiplyAdd(DamageRange, Scale, MinDamage);
+        VectorStore(Damage, Damages + i);
+        VectorStore(VectorMultiply(Damage, InvBaseDamage), KnockbackScales + i);
+    }
+
+    for (int32 i = 0; i < NumVictims; i++)
+    {
+        FUR_SplashDamageVictim& Victim = Victims[i];
+        Victim.Distance = Distances[i];
+        Victim.DamageScale = Scales[i];
+        Victim.Damage = Damages[i];
+        Victim.KnockbackScale = KnockbackScales[i];
+    }
+}
+
+bool FUR_SplashDamageResolver::Apply(AController* InstigatedBy, AActor* DamageCauser) const
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_URSplashDamage_Apply);
+
+    FUR_SplashDamageEvent DamageEvent;
+    DamageEvent.DamageTypeClass = DamageTypeClass;
+    DamageEvent.Origin = Origin;
+    DamageEvent.Params = Params;
+
+    // Out of reach victims resolve to zero damage and TakeDamage would early out.
+    // The 1uu margin keeps float rounding from skipping a victim sitting right on the edge.
+    const float OuterRadius = FMath::Max(Params.OuterRadius, Params.InnerRadius) + 1.f;
+    const bool bCanSkipOutOfReach = (Params.MinimumDamage == 0.f);
+
+    bool bAppliedDamage = false;
+    for (const FUR_SplashDamageVictim& Victim : Victims)
+    {
+        AActor* VictimActor = Victim.Actor.Get();
+        if (VictimActor == nullptr || (bCanSkipOutOfReach && Victim.Distance > OuterRadius))
+        {
+            continue;
+        }
+
+        // BaseDamage stays the event's full damage, the resolved values ride along for the victim to use as they are
+        DamageEvent.ComponentHits = Victim.ComponentHits;
+        DamageEvent.Damage = Victim.Damage;
+        DamageEvent.KnockbackScale = Victim.KnockbackScale;
+        VictimActor->TakeDamage(Params.BaseDamage, DamageEvent, InstigatedBy, DamageCauser);
+        bAppliedDamage = true;
+    }
+
+    return bAppliedDamage;
+}
@@ -0,0 +1,96 @@
+// Copyright (c) Open Tournament Games, All Rights Reserved.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Engine/DamageEvents.h"
+#include "Engine/HitResult.h"
+#include "Templates/SubclassOf.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AActor;
+class AController;
+class UDamageType;
+class UWorld;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+* Radial damage event carrying the damage already resolved by FUR_SplashDamageResolver.
+*
+* Still a FRadialDamageEvent (and replicated as one), so radial handling downstream is unchanged.
+* AUR_Character takes Damage and KnockbackScale as they are instead of recomputing the falloff from Params.
+* Other actors ignore them and go through AActor::InternalTakeRadialDamage, which resolves to the same value.
+*/
+struct OPENTOURNAMENT_API FUR_SplashDamageEvent : public FRadialDamageEvent
+{
+    // Damage after falloff, before the victim's own modifiers (gamemode hook, floor...)
+    float Damage = 0.f;
+
+    // Damage / BaseDamage, scales the knockback of the full damage
+    float KnockbackScale = 0.f;
+
+    /** Out of the engine's ID range (0-2) */
+    static const int32 ClassID = 100;
+
+    // GetTypeID is left to FRadialDamageEvent so the event replicates as radial damage
+    virtual bool IsOfType(int32 InID) const override { return (FUR_SplashDamageEvent::ClassID == InID) || FRadialDamageEvent::IsOfType(InID); }
+};
+
+/**
+* One actor reached by a splash, in application order.
+*/
+struct FUR_SplashDamageVictim
+{
+    TWeakObjectPtr<AActor> Actor;
+
+    // Visible components of the actor, as passed to TakeDamage in the FUR_SplashDamageEvent
+    TArray<FHitResult> ComponentHits;
+
+    // Distance from the origin to the closest hit
+    float Distance = 0.f;
+
+    // Falloff scale and resulting damage, before the victim's own modifiers (gamemode hook, floor...)
+    float DamageScale = 0.f;
+    float Damage = 0.f;
+
+    // Damage / BaseDamage
+    float KnockbackScale = 0.f;
+};
+
+/**
+* Splash damage resolver for projectiles.
+*
+* Same rules as UGameplayStatics::ApplyRadialDamageWithFalloff (dynamic objects overlap, visibility trace to
+* each component center, closest hit falloff) but resolved in passes:
+* - one overlap gathers every candidate component,
+* - occlusion traces are issued back to back with shared query params,
+* - falloff damage and knockback scale are computed for all victims at once, 4 lanes at a time,
+* - each victim is then handed its resolved values in a FUR_SplashDamageEvent through TakeDamage, so AUR_Character
+*   and the gamemode hook see radial damage as they used to without computing the falloff again.
+*   Victims the falloff resolves to zero damage are not called at all.
+*/
+struct OPENTOURNAMENT_API FUR_SplashDamageResolver
+{
+    FUR_SplashDamageResolver(const FVector& InOrigin, const FRadialDamageParams& InParams, TSubclassOf<UDamageType> InDamageTypeClass, ECollisionChannel InPreventionChannel = ECC_Visibility);
+
+    /** Gather and trace candidates around Origin, then compute falloff for each of them. Returns the number of victims. */
+    int32 Resolve(const UWorld* World, const TArray<AActor*>& IgnoreActors, const AActor* DamageCauser);
+
+    /** Apply resolved damage to every victim. Returns true if any victim was damaged. */
+    bool Apply(AController* InstigatedBy, AActor* DamageCauser) const;
+
+    TConstArrayView<FUR_SplashDamageVictim> GetVictims() const { return Victims; }
+
+private:
+    void ComputeFalloff();
+
+    FVector Origin;
+    FRadialDamageParams Params;
+    TSubclassOf<UDamageType> DamageTypeClass;
+    ECollisionChannel PreventionChannel;
+
+    TArray<FUR_SplashDamageVictim, TInlineAllocator<8>> Victims;
+};